@@ -8,9 +8,10 @@
  #include <string.h>
  
  // headers do display OLED
- #include "src/ssd1306.h"
- #include "src/ssd1306_i2c.h"
- #include "src/ssd1306_font.h"
+ #include "ssd1306.h"
+ #include "ssd1306_i2c.h"
+ #include "ssd1306_font.h"
+ #include "ssd1306_text_cache.h"
  
  // Definições dos botões e pinos
  #define BUTTON_A 5  // Reinicia/começa a contagem
@@ -36,18 +37,22 @@
  
  // Objeto global do display OLED
  ssd1306_t disp;
+ // Rótulos fixos renderizados uma vez só
+ static ssd1306_text_cache_t text_cache;
  
  // Função para atualizar o display OLED com os valores atuais
  void update_display(void) {
-     char linha1[32], linha2[32];
-     // Formata as strings: uma linha para o contador e outra para os cliques
-     snprintf(linha1, sizeof(linha1), "Contador: %d", countdown_value);
-     snprintf(linha2, sizeof(linha2), "Botao B: %d", b_press_count);
+     char num[12];
+     uint32_t x;
      
      ssd1306_clear(&disp);
-     // Exibe na posição
-     ssd1306_draw_string(&disp, 0, 0, 1, linha1);
-     ssd1306_draw_string(&disp, 0, 16, 1, linha2);
+     // Rótulo vem do cache, só o número é desenhado a cada atualização
+     x = ssd1306_draw_cached_string_with_font(&disp, &text_cache, 0, 0, 1, font_8x5, "Contador: ");
+     snprintf(num, sizeof(num), "%d", countdown_value);
+     ssd1306_draw_string(&disp, x, 0, 1, num);
+     x = ssd1306_draw_cached_string_with_font(&disp, &text_cache, 0, 16, 1, font_8x5, "Botao B: ");
+     snprintf(num, sizeof(num), "%d", b_press_count);
+     ssd1306_draw_string(&disp, x, 16, 1, num);
      ssd1306_show(&disp);
  }
  
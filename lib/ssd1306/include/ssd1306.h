@@ -0,0 +1,722 @@
+/*
+MIT License
+
+Copyright (c) 2021 David Schramm
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/** 
+* @file ssd1306.h
+* 
+* simple driver for ssd1306 displays
+*/
+
+#ifndef _inc_ssd1306
+#define _inc_ssd1306
+#ifdef SSD1306_HOST
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+typedef struct i2c_inst i2c_inst_t;
+#else
+#include <pico/stdlib.h>
+#include "hardware/i2c.h"
+#endif
+
+/**
+*	@brief defines commands used in ssd1306
+*/
+typedef enum {
+    SET_CONTRAST = 0x81,
+    SET_ENTIRE_ON = 0xA4,
+    SET_NORM_INV = 0xA6,
+    SET_DISP = 0xAE,
+    SET_MEM_ADDR = 0x20,
+    SET_COL_ADDR = 0x21,
+    SET_PAGE_ADDR = 0x22,
+    SET_DISP_START_LINE = 0x40,
+    SET_SEG_REMAP = 0xA0,
+    SET_MUX_RATIO = 0xA8,
+    SET_COM_OUT_DIR = 0xC0,
+    SET_DISP_OFFSET = 0xD3,
+    SET_COM_PIN_CFG = 0xDA,
+    SET_DISP_CLK_DIV = 0xD5,
+    SET_PRECHARGE = 0xD9,
+    SET_VCOM_DESEL = 0xDB,
+    SET_CHARGE_PUMP = 0x8D,
+    SET_HSCROLL = 0x26,
+    SET_VHSCROLL = 0x29,
+    SET_SCROLL_OFF = 0x2E,
+    SET_SCROLL_ON = 0x2F,
+    SET_VSCROLL_AREA = 0xA3
+} ssd1306_command_t;
+
+/**
+*	@brief direction of the horizontal part of a hardware scroll
+*/
+typedef enum {
+    SSD1306_SCROLL_RIGHT,	/**< content moves to higher columns */
+    SSD1306_SCROLL_LEFT		/**< content moves to lower columns */
+} ssd1306_scroll_dir_t;
+
+/**
+*	@brief frames between two hardware scroll steps, as encoded by the controller
+*/
+typedef enum {
+    SSD1306_SCROLL_2_FRAMES = 7,
+    SSD1306_SCROLL_3_FRAMES = 4,
+    SSD1306_SCROLL_4_FRAMES = 5,
+    SSD1306_SCROLL_5_FRAMES = 0,
+    SSD1306_SCROLL_25_FRAMES = 6,
+    SSD1306_SCROLL_64_FRAMES = 1,
+    SSD1306_SCROLL_128_FRAMES = 2,
+    SSD1306_SCROLL_256_FRAMES = 3
+} ssd1306_scroll_speed_t;
+
+/**
+*	@brief largest command sequence sent in a single i2c transfer by ssd1306_write_cmds
+*/
+#ifndef SSD1306_CMD_CHUNK
+#define SSD1306_CMD_CHUNK 32
+#endif
+
+/**
+*	@brief how ssd1306_fill_square combines the square with the buffer
+*/
+typedef enum {
+    SSD1306_FILL_SET,	/**< pixels on */
+    SSD1306_FILL_CLEAR,	/**< pixels off */
+    SSD1306_FILL_XOR	/**< pixels toggled */
+} ssd1306_fill_mode_t;
+
+/**
+*	@brief rectangular window of display RAM, in columns and pages (x0>x1 means empty)
+*/
+typedef struct {
+    uint8_t x0;		/**< first column */
+    uint8_t x1;		/**< last column */
+    uint8_t p0;		/**< first page */
+    uint8_t p1;		/**< last page */
+} ssd1306_window_t;
+
+/**
+*	@brief glyph of a font atlas, see ssd1306_font_atlas.h
+*/
+typedef struct {
+    uint16_t offset;	/**< first column in ssd1306_atlas_t.cols */
+    uint8_t width;		/**< columns with ink, 0 for blank glyphs */
+    uint8_t advance;	/**< pixels to the next glyph at scale 1, spacing included */
+    uint16_t kern;		/**< first entry in ssd1306_atlas_t.kern with this glyph on the left */
+    uint8_t kern_count;	/**< entries with this glyph on the left */
+} ssd1306_glyph_t;
+
+/**
+*	@brief advance correction for a pair of glyphs
+*/
+typedef struct {
+    char right;		/**< glyph following the left one */
+    int8_t adjust;	/**< pixels added to the advance of the left glyph */
+} ssd1306_kern_t;
+
+/**
+*	@brief font decoded at build time: trimmed glyph columns, widths and kerning (generated by tools/gen_font_atlas.c)
+*/
+typedef struct {
+    uint8_t height;		/**< rows, at most 32 */
+    uint8_t parts;		/**< bytes per column, (height+7)/8 */
+    char first;			/**< first character */
+    char last;			/**< last character */
+    const ssd1306_glyph_t *glyphs;	/**< glyphs first..last */
+    const uint8_t *cols;	/**< columns of all glyphs, parts bytes each, bit 0 on top */
+    const ssd1306_kern_t *kern;	/**< pairs grouped by left glyph */
+} ssd1306_atlas_t;
+
+/**
+*	@brief encoding of ssd1306_image_t.data, both in display page order (page 0 columns 0..width-1, then page 1, ...)
+*/
+typedef enum {
+    SSD1306_IMAGE_RAW,	/**< pages*width bytes as they go to the display */
+    SSD1306_IMAGE_RLE	/**< control byte c<0x80: c+1 bytes follow; c>=0x80: the next byte repeated c-0x7e times */
+} ssd1306_image_format_t;
+
+/**
+*	@brief 1 bit image in display page layout, generated by tools/img2ssd1306.c
+*/
+typedef struct {
+    uint8_t width;		/**< columns */
+    uint8_t pages;		/**< height in pages of 8 rows */
+    uint8_t format;		/**< ssd1306_image_format_t */
+    uint16_t size;		/**< bytes in data */
+    const uint8_t *data;	/**< encoded bytes */
+} ssd1306_image_t;
+
+/**
+*	@brief transport replacing i2c_write_blocking, e.g. the host emulator in ssd1306_host.h
+*/
+typedef struct {
+    /**
+    	@brief write one transfer (control byte followed by commands or data)
+
+    	@return number of bytes written, PICO_ERROR_GENERIC or PICO_ERROR_TIMEOUT
+    */
+    int (*write)(void *ctx, uint8_t addr, const uint8_t *src, size_t len);
+} ssd1306_backend_t;
+
+/**
+*	@brief holds the configuration
+*/
+typedef struct {
+    uint8_t width; 		/**< width of display */
+    uint8_t height; 	/**< height of display */
+    uint8_t pages;		/**< stores pages of display (calculated on initialization*/
+    uint8_t address; 	/**< i2c address of display*/
+    i2c_inst_t *i2c_i; 	/**< i2c connection instance */
+    const ssd1306_backend_t *backend;	/**< transport used instead of i2c_i when not NULL, set only by the init functions */
+    void *backend_ctx;	/**< argument passed to backend->write */
+    bool external_vcc; 	/**< whether display uses external vcc */ 
+    uint8_t *buffer;	/**< display buffer */
+    size_t bufsize;		/**< buffer size */
+    ssd1306_window_t dirty;	/**< area changed since last ssd1306_show */
+    ssd1306_window_t ink;	/**< area that may hold set pixels since last ssd1306_clear */
+    uint8_t *shadow;	/**< copy of the last frame sent, NULL when diffing is off */
+    bool resend;		/**< next show sends the whole dirty window without diffing */
+    uint16_t *dma_buf;	/**< i2c data_cmd words of the frame in flight, NULL without ssd1306_async_init */
+    int dma_chan;		/**< dma channel feeding the i2c tx fifo */
+    volatile bool busy;	/**< asynchronous frame still on the bus */
+    uint8_t heap;		/**< SSD1306_HEAP_* bits of the buffers freed by the deinit functions */
+    uint8_t start_line;	/**< display RAM row shown on the top line, see ssd1306_start_line */
+    bool scrolling;		/**< hardware scroll running, display RAM may not be written */
+} ssd1306_t;
+
+/**
+*	@brief buffers of ssd1306_t that were allocated by the driver
+*/
+enum {
+    SSD1306_HEAP_BUFFER = 1,	/**< buffer, from ssd1306_init */
+    SSD1306_HEAP_SHADOW = 2,	/**< shadow, from ssd1306_shadow_init */
+    SSD1306_HEAP_DMA = 4		/**< dma_buf, from ssd1306_async_init */
+};
+
+/**
+*	@brief bytes of one frame of a width x height display
+*/
+#define SSD1306_FRAME_BYTES(width, height) ((size_t)(width)*((height)/8))
+
+/**
+*	@brief 32 bit words for ssd1306_init_static: the frame plus a word holding the 0x40 control byte
+*/
+#define SSD1306_BUFFER_WORDS(width, height) ((SSD1306_FRAME_BYTES(width, height)+3)/4+1)
+
+/**
+*	@brief 16 bit words for ssd1306_async_init_static: one i2c data_cmd word per byte plus the control byte
+*/
+#define SSD1306_DMA_WORDS(width, height) (SSD1306_FRAME_BYTES(width, height)+1)
+
+/**
+*	@brief upper bound, in bytes, for the storage declared by SSD1306_STATIC_BUFFER and SSD1306_STATIC_STORAGE
+*
+*	checked at compile time; set by the SSD1306_RAM_BUDGET cache variable of lib/ssd1306/CMakeLists.txt
+*/
+#ifndef SSD1306_RAM_BUDGET
+#define SSD1306_RAM_BUDGET 4608
+#endif
+
+/**
+*	@brief compile time checks of the static storage macros
+*/
+#define SSD1306_STATIC_CHECK(name, width, height) \
+    _Static_assert((width)>0 && (width)<=128 && (height)%8==0 && (height)>0 && (height)<=64, \
+                   "ssd1306: " #name " is not a 128x64 or smaller display"); \
+    _Static_assert(sizeof(name)<=SSD1306_RAM_BUDGET, "ssd1306: " #name " exceeds SSD1306_RAM_BUDGET")
+
+/**
+*	@brief declare a static display buffer for ssd1306_init_static, e.g. SSD1306_STATIC_BUFFER(oled_buf, 128, 32)
+*/
+#define SSD1306_STATIC_BUFFER(name, width, height) \
+    static uint32_t name[SSD1306_BUFFER_WORDS(width, height)]; \
+    SSD1306_STATIC_CHECK(name, width, height)
+
+/**
+*	@brief declare static display, shadow and dma staging buffers, e.g. SSD1306_STATIC_STORAGE(oled_mem, 128, 64)
+*
+*	pass name.buffer to ssd1306_init_static, name.shadow to ssd1306_shadow_init_static
+*	and name.dma to ssd1306_async_init_static
+*/
+#define SSD1306_STATIC_STORAGE(name, width, height) \
+    static struct { \
+        uint32_t buffer[SSD1306_BUFFER_WORDS(width, height)]; \
+        _Alignas(uint32_t) uint8_t shadow[SSD1306_FRAME_BYTES(width, height)]; \
+        uint16_t dma[SSD1306_DMA_WORDS(width, height)]; \
+    } name; \
+    SSD1306_STATIC_CHECK(name, width, height)
+
+/**
+*	@brief initialize display
+*
+*	@param[in] p : pointer to instance of ssd1306_t
+*	@param[in] width : width of display
+*	@param[in] height : heigth of display
+*	@param[in] address : i2c address of display
+*	@param[in] i2c_instance : instance of i2c connection
+*	
+* 	@return bool.
+*	@retval true for Success
+*	@retval false if initialization failed
+*/
+bool ssd1306_init(ssd1306_t *p, uint16_t width, uint16_t height, uint8_t address, i2c_inst_t *i2c_instance);
+
+/**
+*	@brief initialize display on a caller provided buffer, without using the heap
+*
+*	@param[in] p : pointer to instance of ssd1306_t
+*	@param[in] width : width of display
+*	@param[in] height : heigth of display
+*	@param[in] address : i2c address of display
+*	@param[in] i2c_instance : instance of i2c connection
+*	@param[in] mem : SSD1306_BUFFER_WORDS(width, height) words, see SSD1306_STATIC_BUFFER
+*	@param[in] len : size of mem in bytes
+*
+* 	@return bool.
+*	@retval true for Success
+*	@retval false if mem is too small
+*/
+bool ssd1306_init_static(ssd1306_t *p, uint16_t width, uint16_t height, uint8_t address, i2c_inst_t *i2c_instance, uint32_t *mem, size_t len);
+
+/**
+*	@brief initialize display on a transport other than i2c, e.g. the host emulator in ssd1306_host.h
+*
+*	ssd1306_init and ssd1306_init_static always select i2c; this is the only way to set backend,
+*	so p does not need to be zeroed first
+*
+*	@param[in] p : pointer to instance of ssd1306_t
+*	@param[in] width : width of display
+*	@param[in] height : heigth of display
+*	@param[in] address : address passed to backend->write
+*	@param[in] backend : transport, must stay valid while the display is in use
+*	@param[in] backend_ctx : first argument of backend->write
+*
+* 	@return bool.
+*	@retval true for Success
+*	@retval false if initialization failed
+*/
+bool ssd1306_init_backend(ssd1306_t *p, uint16_t width, uint16_t height, uint8_t address, const ssd1306_backend_t *backend, void *backend_ctx);
+
+/**
+*	@brief ssd1306_init_backend on a caller provided buffer, without using the heap
+*
+*	@param[in] p : pointer to instance of ssd1306_t
+*	@param[in] width : width of display
+*	@param[in] height : heigth of display
+*	@param[in] address : address passed to backend->write
+*	@param[in] backend : transport, must stay valid while the display is in use
+*	@param[in] backend_ctx : first argument of backend->write
+*	@param[in] mem : SSD1306_BUFFER_WORDS(width, height) words, see SSD1306_STATIC_BUFFER
+*	@param[in] len : size of mem in bytes
+*
+* 	@return bool.
+*	@retval true for Success
+*	@retval false if mem is too small
+*/
+bool ssd1306_init_backend_static(ssd1306_t *p, uint16_t width, uint16_t height, uint8_t address, const ssd1306_backend_t *backend, void *backend_ctx, uint32_t *mem, size_t len);
+
+/**
+*	@brief deinitialize display
+*
+*	@param[in] p : instance of display
+*
+*/
+void ssd1306_deinit(ssd1306_t *p);
+
+/**
+*	@brief turn off display
+*
+*	@param[in] p : instance of display
+*
+*/
+void ssd1306_poweroff(ssd1306_t *p);
+
+/**
+	@brief turn on display
+
+	@param[in] p : instance of display
+
+*/
+void ssd1306_poweron(ssd1306_t *p);
+
+/**
+	@brief send a sequence of commands (with their arguments) in one i2c transfer
+
+	@param[in] p : instance of display
+	@param[in] cmds : command bytes
+	@param[in] len : number of command bytes
+
+*/
+void ssd1306_write_cmds(ssd1306_t *p, const uint8_t *cmds, size_t len);
+
+/**
+	@brief set contrast of display
+
+	@param[in] p : instance of display
+	@param[in] val : contrast
+
+*/
+void ssd1306_contrast(ssd1306_t *p, uint8_t val);
+
+/**
+	@brief set invert display
+
+	@param[in] p : instance of display
+	@param[in] inv : inv==0: disable inverting, inv!=0: invert
+
+*/
+void ssd1306_invert(ssd1306_t *p, uint8_t inv);
+
+/**
+	@brief set the display RAM row shown on the top line, moving the whole image up by line rows
+
+	costs one command byte and no display data. Buffer coordinates stay those of
+	display RAM: on a 64 row display the row shown at y is (y+line)%64. A ticker
+	draws its new line on the rows about to wrap in, shows them, then advances
+	the start line
+
+	@param[in] p : instance of display
+	@param[in] line : 0..63
+
+*/
+void ssd1306_start_line(ssd1306_t *p, uint8_t line);
+
+/**
+	@brief start a continuous hardware scroll of pages p0..p1, done by the controller without bus traffic
+
+	display RAM must not be written while scrolling: ssd1306_show and ssd1306_show_async
+	keep drawing pending until ssd1306_scroll_stop
+
+	@param[in] p : instance of display
+	@param[in] dir : direction of the horizontal movement
+	@param[in] p0 : first page scrolled
+	@param[in] p1 : last page scrolled
+	@param[in] speed : frames between steps
+	@param[in] vertical : rows moved up per step inside the area of ssd1306_scroll_area, 0 for horizontal only
+
+*/
+void ssd1306_scroll(ssd1306_t *p, ssd1306_scroll_dir_t dir, uint8_t p0, uint8_t p1, ssd1306_scroll_speed_t speed, uint8_t vertical);
+
+/**
+	@brief rows moved by the vertical part of ssd1306_scroll, the rest stays fixed (whole display after reset)
+
+	@param[in] p : instance of display
+	@param[in] top : rows fixed above the area
+	@param[in] rows : rows in the area
+
+*/
+void ssd1306_scroll_area(ssd1306_t *p, uint8_t top, uint8_t rows);
+
+/**
+	@brief stop the hardware scroll
+
+	the controller leaves display RAM where the scroll moved it, so the next show resends the whole buffer
+
+	@param[in] p : instance of display
+
+*/
+void ssd1306_scroll_stop(ssd1306_t *p);
+
+/**
+	@brief display buffer, should be called on change
+
+	only the window changed since the last call is sent; nothing is sent if the buffer is unchanged
+
+	@param[in] p : instance of display
+
+*/
+void ssd1306_show(ssd1306_t *p);
+
+/**
+	@brief keep a copy of the last frame sent so ssd1306_show only sends the bytes that changed
+
+	allocates bufsize bytes; the next show sends the whole display to fill the copy
+
+	@param[in] p : instance of display, already initialized
+
+	@return bool.
+	@retval true for Success
+	@retval false if no memory is available
+*/
+bool ssd1306_shadow_init(ssd1306_t *p);
+
+/**
+	@brief like ssd1306_shadow_init, keeping the copy in a caller provided buffer
+
+	@param[in] p : instance of display, already initialized
+	@param[in] mem : SSD1306_FRAME_BYTES(width, height) bytes, 4 byte aligned (compared a word at a time), see SSD1306_STATIC_STORAGE
+	@param[in] len : size of mem in bytes
+
+	@return bool.
+	@retval true for Success
+	@retval false if mem is too small or not 4 byte aligned
+*/
+bool ssd1306_shadow_init_static(ssd1306_t *p, uint8_t *mem, size_t len);
+
+/**
+	@brief stop diffing and free the copy of the last frame (a caller provided copy is only dropped)
+
+	@param[in] p : instance of display
+
+*/
+void ssd1306_shadow_deinit(ssd1306_t *p);
+
+/**
+	@brief send addressing for the changed window and mark it as sent
+
+	used by ssd1306_show and ssd1306_show_async, the caller must then send the window data
+
+	@param[in] p : instance of display
+	@param[out] win : window to be sent
+
+	@return bool.
+	@retval true if win must be sent
+	@retval false if nothing changed or a hardware scroll is running
+*/
+bool ssd1306_show_begin(ssd1306_t *p, ssd1306_window_t *win);
+
+/**
+	@brief mark whole buffer as changed, needed after writing to p->buffer directly
+
+	@param[in] p : instance of display
+
+*/
+void ssd1306_invalidate(ssd1306_t *p);
+
+/**
+	@brief clear display buffer
+
+	@param[in] p : instance of display
+
+*/
+void ssd1306_clear(ssd1306_t *p);
+
+/**
+	@brief clear pixel on buffer
+
+	@param[in] p : instance of display
+	@param[in] x : x position
+	@param[in] y : y position
+*/
+void ssd1306_clear_pixel(ssd1306_t *p, uint32_t x, uint32_t y);
+
+/**
+	@brief draw pixel on buffer
+
+	@param[in] p : instance of display
+	@param[in] x : x position
+	@param[in] y : y position
+*/
+void ssd1306_draw_pixel(ssd1306_t *p, uint32_t x, uint32_t y);
+
+/**
+	@brief draw line on buffer
+
+	@param[in] p : instance of display
+	@param[in] x1 : x position of starting point
+	@param[in] y1 : y position of starting point
+	@param[in] x2 : x position of end point
+	@param[in] y2 : y position of end point
+*/
+void ssd1306_draw_line(ssd1306_t *p, int32_t x1, int32_t y1, int32_t x2, int32_t y2);
+
+/**
+	@brief clear square at given position with given size
+
+	@param[in] p : instance of display
+	@param[in] x : x position of starting point
+	@param[in] y : y position of starting point
+	@param[in] width : width of square
+	@param[in] height : height of square
+*/
+void ssd1306_clear_square(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+
+/**
+	@brief draw filled square at given position with given size
+
+	@param[in] p : instance of display
+	@param[in] x : x position of starting point
+	@param[in] y : y position of starting point
+	@param[in] width : width of square
+	@param[in] height : height of square
+*/
+void ssd1306_draw_square(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+
+/**
+	@brief set, clear or toggle a square, whole pages are filled a byte at a time
+
+	@param[in] p : instance of display
+	@param[in] x : x position of starting point
+	@param[in] y : y position of starting point
+	@param[in] width : width of square
+	@param[in] height : height of square
+	@param[in] mode : SSD1306_FILL_SET, SSD1306_FILL_CLEAR or SSD1306_FILL_XOR
+*/
+void ssd1306_fill_square(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t width, uint32_t height, ssd1306_fill_mode_t mode);
+
+/**
+	@brief draw empty square at given position with given size
+
+	@param[in] p : instance of display
+	@param[in] x : x position of starting point
+	@param[in] y : y position of starting point
+	@param[in] width : width of square
+	@param[in] height : height of square
+*/
+void ssd1306_draw_empty_square(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+
+/**
+	@brief draw monochrome bitmap with offset
+
+	plots pixel by pixel from an uncompressed BMP file, ssd1306_draw_image is the fast path
+
+	@param[in] p : instance of display
+	@param[in] data : image data (whole file)
+	@param[in] size : size of image data in bytes
+	@param[in] x_offset : offset of horizontal coordinate
+	@param[in] y_offset : offset of vertical coordinate
+*/
+void ssd1306_bmp_show_image_with_offset(ssd1306_t *p, const uint8_t *data, const long size, uint32_t x_offset, uint32_t y_offset);
+
+/**
+	@brief draw monochrome bitmap
+
+	@param[in] p : instance of display
+	@param[in] data : image data (whole file)
+	@param[in] size : size of image data in bytes
+*/
+void ssd1306_bmp_show_image(ssd1306_t *p, const uint8_t *data, const long size);
+
+/**
+	@brief OR a bitmap in page layout into the buffer: pages rows of cols bytes, bit 0 of each byte on top
+
+	any y works, a bitmap row off the page grid is split across two pages
+
+	@param[in] p : instance of display
+	@param[in] x : x position of the left column
+	@param[in] y : y position of the top row
+	@param[in] src : pages*cols bytes
+	@param[in] cols : width in pixels
+	@param[in] pages : height in pages of 8 rows
+*/
+void ssd1306_draw_pages(ssd1306_t *p, uint32_t x, uint32_t y, const uint8_t *src, uint32_t cols, uint32_t pages);
+
+/**
+	@brief draw image, replacing the pixels under it; bytes are copied (or shifted when y is not page aligned), never plotted
+
+	@param[in] p : instance of display
+	@param[in] x : x position of the left column
+	@param[in] y : y position of the top row
+	@param[in] img : image from tools/img2ssd1306.c
+*/
+void ssd1306_draw_image(ssd1306_t *p, uint32_t x, uint32_t y, const ssd1306_image_t *img);
+
+/**
+	@brief draw char with given font
+
+	@param[in] p : instance of display
+	@param[in] x : x starting position of char
+	@param[in] y : y starting position of char
+	@param[in] scale : scale font to n times of original size (default should be 1)
+	@param[in] font : pointer to font
+	@param[in] c : character to draw
+*/
+void ssd1306_draw_char_with_font(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, const uint8_t *font, char c);
+
+/**
+	@brief draw char with builtin font
+
+	@param[in] p : instance of display
+	@param[in] x : x starting position of char
+	@param[in] y : y starting position of char
+	@param[in] scale : scale font to n times of original size (default should be 1)
+	@param[in] c : character to draw
+*/
+void ssd1306_draw_char(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, char c);
+
+/**
+	@brief draw string with given font
+
+	@param[in] p : instance of display
+	@param[in] x : x starting position of text
+	@param[in] y : y starting position of text
+	@param[in] scale : scale font to n times of original size (default should be 1)
+	@param[in] font : pointer to font
+	@param[in] s : text to draw
+*/
+void ssd1306_draw_string_with_font(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, const uint8_t *font, const char *s );
+
+/**
+	@brief draw char from a font atlas
+
+	scale 1 ORs whole byte columns, larger scales fill one square per run of set rows
+
+	@param[in] p : instance of display
+	@param[in] x : x starting position of char
+	@param[in] y : y starting position of char
+	@param[in] scale : scale font to n times of original size
+	@param[in] atlas : font atlas, e.g. ssd1306_atlas_8x5
+	@param[in] c : character to draw
+
+	@return advance in pixels, without kerning
+*/
+uint32_t ssd1306_draw_char_with_atlas(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, const ssd1306_atlas_t *atlas, char c);
+
+/**
+	@brief draw proportional, kerned string from a font atlas
+
+	@param[in] p : instance of display
+	@param[in] x : x starting position of text
+	@param[in] y : y starting position of text
+	@param[in] scale : scale font to n times of original size
+	@param[in] atlas : font atlas, e.g. ssd1306_atlas_8x5
+	@param[in] s : text to draw
+
+	@return x after the last glyph
+*/
+uint32_t ssd1306_draw_string_with_atlas(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, const ssd1306_atlas_t *atlas, const char *s);
+
+/**
+	@brief width of a string drawn by ssd1306_draw_string_with_atlas, e.g. to right align counters
+
+	@param[in] atlas : font atlas
+	@param[in] scale : scale of the text
+	@param[in] s : text
+
+	@return width in pixels, trailing spacing excluded
+*/
+uint32_t ssd1306_string_width_with_atlas(const ssd1306_atlas_t *atlas, uint32_t scale, const char *s);
+
+/**
+	@brief draw string with builtin font
+
+	@param[in] p : instance of display
+	@param[in] x : x starting position of text
+	@param[in] y : y starting position of text
+	@param[in] scale : scale font to n times of original size (default should be 1)
+	@param[in] s : text to draw
+*/
+void ssd1306_draw_string(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, const char *s);
+
+#endif
\ No newline at end of file
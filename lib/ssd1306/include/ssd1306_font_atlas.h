@@ -0,0 +1,295 @@
+/*
+ * Gerado por tools/gen_font_atlas.c a partir de ssd1306_font.h, nao editar.
+ *
+ * Desenhar com ssd1306_draw_string_with_atlas(&disp, x, y, escala, &atlas_8x5, texto).
+ */
+
+#ifndef _inc_font_atlas
+#define _inc_font_atlas
+
+#include "ssd1306.h"
+
+/* font_8x5 proporcional: 8 linhas, digitos com largura fixa, espaco de 3 px */
+static const uint8_t atlas_8x5_cols[] = {
+    0x5F, /* '!' */
+    0x07,0x00,0x07, /* '"' */
+    0x14,0x7F,0x14,0x7F,0x14, /* '#' */
+    0x24,0x2A,0x7F,0x2A,0x12, /* '$' */
+    0x23,0x13,0x08,0x64,0x62, /* '%' */
+    0x36,0x49,0x56,0x20,0x50, /* '&' */
+    0x08,0x07,0x03, /* '\'' */
+    0x1C,0x22,0x41, /* '(' */
+    0x41,0x22,0x1C, /* ')' */
+    0x2A,0x1C,0x7F,0x1C,0x2A, /* '*' */
+    0x08,0x08,0x3E,0x08,0x08, /* '+' */
+    0x80,0x70,0x30, /* ',' */
+    0x08,0x08,0x08,0x08,0x08, /* '-' */
+    0x60,0x60, /* '.' */
+    0x20,0x10,0x08,0x04,0x02, /* '/' */
+    0x3E,0x51,0x49,0x45,0x3E, /* '0' */
+    0x00,0x42,0x7F,0x40,0x00, /* '1' */
+    0x72,0x49,0x49,0x49,0x46, /* '2' */
+    0x21,0x41,0x49,0x4D,0x33, /* '3' */
+    0x18,0x14,0x12,0x7F,0x10, /* '4' */
+    0x27,0x45,0x45,0x45,0x39, /* '5' */
+    0x3C,0x4A,0x49,0x49,0x31, /* '6' */
+    0x41,0x21,0x11,0x09,0x07, /* '7' */
+    0x36,0x49,0x49,0x49,0x36, /* '8' */
+    0x46,0x49,0x49,0x29,0x1E, /* '9' */
+    0x14, /* ':' */
+    0x40,0x34, /* ';' */
+    0x08,0x14,0x22,0x41, /* '<' */
+    0x14,0x14,0x14,0x14,0x14, /* '=' */
+    0x41,0x22,0x14,0x08, /* '>' */
+    0x02,0x01,0x59,0x09,0x06, /* '?' */
+    0x3E,0x41,0x5D,0x59,0x4E, /* '@' */
+    0x7C,0x12,0x11,0x12,0x7C, /* 'A' */
+    0x7F,0x49,0x49,0x49,0x36, /* 'B' */
+    0x3E,0x41,0x41,0x41,0x22, /* 'C' */
+    0x7F,0x41,0x41,0x41,0x3E, /* 'D' */
+    0x7F,0x49,0x49,0x49,0x41, /* 'E' */
+    0x7F,0x09,0x09,0x09,0x01, /* 'F' */
+    0x3E,0x41,0x41,0x51,0x73, /* 'G' */
+    0x7F,0x08,0x08,0x08,0x7F, /* 'H' */
+    0x41,0x7F,0x41, /* 'I' */
+    0x20,0x40,0x41,0x3F,0x01, /* 'J' */
+    0x7F,0x08,0x14,0x22,0x41, /* 'K' */
+    0x7F,0x40,0x40,0x40,0x40, /* 'L' */
+    0x7F,0x02,0x1C,0x02,0x7F, /* 'M' */
+    0x7F,0x04,0x08,0x10,0x7F, /* 'N' */
+    0x3E,0x41,0x41,0x41,0x3E, /* 'O' */
+    0x7F,0x09,0x09,0x09,0x06, /* 'P' */
+    0x3E,0x41,0x51,0x21,0x5E, /* 'Q' */
+    0x7F,0x09,0x19,0x29,0x46, /* 'R' */
+    0x26,0x49,0x49,0x49,0x32, /* 'S' */
+    0x03,0x01,0x7F,0x01,0x03, /* 'T' */
+    0x3F,0x40,0x40,0x40,0x3F, /* 'U' */
+    0x1F,0x20,0x40,0x20,0x1F, /* 'V' */
+    0x3F,0x40,0x38,0x40,0x3F, /* 'W' */
+    0x63,0x14,0x08,0x14,0x63, /* 'X' */
+    0x03,0x04,0x78,0x04,0x03, /* 'Y' */
+    0x61,0x59,0x49,0x4D,0x43, /* 'Z' */
+    0x7F,0x41,0x41,0x41, /* '[' */
+    0x02,0x04,0x08,0x10,0x20, /* '\\' */
+    0x41,0x41,0x41,0x7F, /* ']' */
+    0x04,0x02,0x01,0x02,0x04, /* '^' */
+    0x40,0x40,0x40,0x40,0x40, /* '_' */
+    0x03,0x07,0x08, /* '`' */
+    0x20,0x54,0x54,0x78,0x40, /* 'a' */
+    0x7F,0x28,0x44,0x44,0x38, /* 'b' */
+    0x38,0x44,0x44,0x44,0x28, /* 'c' */
+    0x38,0x44,0x44,0x28,0x7F, /* 'd' */
+    0x38,0x54,0x54,0x54,0x18, /* 'e' */
+    0x08,0x7E,0x09,0x02, /* 'f' */
+    0x18,0xA4,0xA4,0x9C,0x78, /* 'g' */
+    0x7F,0x08,0x04,0x04,0x78, /* 'h' */
+    0x44,0x7D,0x40, /* 'i' */
+    0x20,0x40,0x40,0x3D, /* 'j' */
+    0x7F,0x10,0x28,0x44, /* 'k' */
+    0x41,0x7F,0x40, /* 'l' */
+    0x7C,0x04,0x78,0x04,0x78, /* 'm' */
+    0x7C,0x08,0x04,0x04,0x78, /* 'n' */
+    0x38,0x44,0x44,0x44,0x38, /* 'o' */
+    0xFC,0x18,0x24,0x24,0x18, /* 'p' */
+    0x18,0x24,0x24,0x18,0xFC, /* 'q' */
+    0x7C,0x08,0x04,0x04,0x08, /* 'r' */
+    0x48,0x54,0x54,0x54,0x24, /* 's' */
+    0x04,0x04,0x3F,0x44,0x24, /* 't' */
+    0x3C,0x40,0x40,0x20,0x7C, /* 'u' */
+    0x1C,0x20,0x40,0x20,0x1C, /* 'v' */
+    0x3C,0x40,0x30,0x40,0x3C, /* 'w' */
+    0x44,0x28,0x10,0x28,0x44, /* 'x' */
+    0x4C,0x90,0x90,0x90,0x7C, /* 'y' */
+    0x44,0x64,0x54,0x4C,0x44, /* 'z' */
+    0x08,0x36,0x41, /* '{' */
+    0x77, /* '|' */
+    0x41,0x36,0x08, /* '}' */
+    0x02,0x01,0x02,0x04,0x02, /* '~' */
+};
+
+static const ssd1306_kern_t atlas_8x5_kern[] = {
+    {',',-1},{'T',-1},{'Y',-1},{'t',-1}, /* ',' */
+    {'T',-1},{'Y',-1},{'f',-1},{'t',-1}, /* '.' */
+    {',',-1},{'I',-1},{'l',-1}, /* ':' */
+    {',',-1}, /* 'B' */
+    {',',-1},{'f',-1}, /* 'C' */
+    {',',-1}, /* 'D' */
+    {':',-1},{'f',-1},{'g',-1},{'q',-1},{'t',-1},{'v',-1}, /* 'E' */
+    {',',-1},{'.',-1},{':',-1},{'A',-1},{'J',-1},{'a',-1},{'c',-1},{'d',-1},{'e',-1},{'f',-1},{'g',-1},{'i',-1},{'j',-1},{'m',-1},{'n',-1},{'o',-1},{'p',-1},{'q',-1},{'r',-1},{'s',-1},{'t',-1},{'u',-1},{'v',-1},{'w',-1},{'x',-1},{'y',-1},{'z',-1}, /* 'F' */
+    {':',-1},{'f',-1},{'g',-1},{'q',-1},{'t',-1},{'v',-1}, /* 'I' */
+    {',',-1},{'.',-1},{':',-1},{'A',-1},{'J',-1},{'a',-1},{'c',-1},{'d',-1},{'e',-1},{'f',-1},{'g',-1},{'i',-1},{'j',-1},{'m',-1},{'n',-1},{'o',-1},{'p',-1},{'q',-1},{'r',-1},{'s',-1},{'t',-1},{'u',-1},{'v',-1},{'w',-1},{'x',-1},{'y',-1},{'z',-1}, /* 'J' */
+    {':',-1},{'f',-1},{'g',-1},{'q',-1},{'t',-1},{'v',-1}, /* 'K' */
+    {':',-1},{'T',-1},{'V',-1},{'Y',-1},{'f',-1},{'g',-1},{'q',-1},{'t',-1},{'v',-1}, /* 'L' */
+    {',',-1}, /* 'O' */
+    {',',-1},{'.',-1},{'J',-1},{'a',-1},{'j',-1}, /* 'P' */
+    {',',-1}, /* 'S' */
+    {',',-1},{'.',-1},{'J',-1},{'a',-1},{'c',-1},{'d',-1},{'e',-1},{'f',-1},{'g',-1},{'j',-1},{'o',-1},{'q',-1},{'s',-1}, /* 'T' */
+    {',',-1}, /* 'U' */
+    {',',-1}, /* 'V' */
+    {',',-1}, /* 'W' */
+    {'f',-1}, /* 'X' */
+    {',',-1},{'.',-1},{'J',-1},{'a',-1},{'c',-1},{'d',-1},{'e',-1},{'f',-1},{'g',-1},{'j',-1},{'o',-1},{'q',-1},{'s',-1}, /* 'Y' */
+    {'f',-1},{'g',-1},{'q',-1}, /* 'Z' */
+    {':',-1},{'T',-1},{'V',-1},{'Y',-1},{'f',-1},{'g',-1},{'q',-1},{'t',-1},{'v',-1}, /* 'a' */
+    {',',-1},{'T',-1},{'Y',-1}, /* 'b' */
+    {',',-1},{'T',-1},{'Y',-1}, /* 'c' */
+    {',',-1},{'I',-1},{'T',-1},{'Y',-1},{'l',-1}, /* 'e' */
+    {',',-1},{'.',-1},{'J',-1},{'a',-1},{'c',-1},{'d',-1},{'e',-1},{'f',-1},{'g',-1},{'j',-1},{'o',-1},{'q',-1},{'s',-1}, /* 'f' */
+    {'T',-1},{'Y',-1}, /* 'g' */
+    {'T',-1},{'Y',-1}, /* 'h' */
+    {':',-1},{'T',-1},{'V',-1},{'Y',-1},{'f',-1},{'g',-1},{'q',-1},{'t',-1},{'v',-1}, /* 'i' */
+    {',',-1}, /* 'j' */
+    {':',-1},{'T',-1},{'V',-1},{'Y',-1},{'f',-1},{'g',-1},{'q',-1},{'t',-1},{'v',-1}, /* 'l' */
+    {'T',-1},{'Y',-1}, /* 'm' */
+    {'T',-1},{'Y',-1}, /* 'n' */
+    {',',-1},{'T',-1},{'Y',-1}, /* 'o' */
+    {',',-1},{'I',-1},{'T',-1},{'Y',-1},{'l',-1}, /* 'p' */
+    {',',-1},{'.',-1},{'I',-1},{'J',-1},{'T',-1},{'X',-1},{'Y',-1},{'Z',-1},{'a',-1},{'j',-1},{'l',-1}, /* 'r' */
+    {',',-1}, /* 's' */
+    {',',-1}, /* 't' */
+    {',',-1},{'I',-1},{'l',-1}, /* 'v' */
+    {',',-1}, /* 'w' */
+};
+
+static const ssd1306_glyph_t atlas_8x5_glyphs[] = {
+    {  0,  0,  3,    0,  0}, /* ' ' */
+    {  0,  1,  2,    0,  0}, /* '!' */
+    {  1,  3,  4,    0,  0}, /* '"' */
+    {  4,  5,  6,    0,  0}, /* '#' */
+    {  9,  5,  6,    0,  0}, /* '$' */
+    { 14,  5,  6,    0,  0}, /* '%' */
+    { 19,  5,  6,    0,  0}, /* '&' */
+    { 24,  3,  4,    0,  0}, /* '\'' */
+    { 27,  3,  4,    0,  0}, /* '(' */
+    { 30,  3,  4,    0,  0}, /* ')' */
+    { 33,  5,  6,    0,  0}, /* '*' */
+    { 38,  5,  6,    0,  0}, /* '+' */
+    { 43,  3,  4,    0,  4}, /* ',' */
+    { 46,  5,  6,    4,  0}, /* '-' */
+    { 51,  2,  3,    4,  4}, /* '.' */
+    { 53,  5,  6,    8,  0}, /* '/' */
+    { 58,  5,  6,    8,  0}, /* '0' */
+    { 63,  5,  6,    8,  0}, /* '1' */
+    { 68,  5,  6,    8,  0}, /* '2' */
+    { 73,  5,  6,    8,  0}, /* '3' */
+    { 78,  5,  6,    8,  0}, /* '4' */
+    { 83,  5,  6,    8,  0}, /* '5' */
+    { 88,  5,  6,    8,  0}, /* '6' */
+    { 93,  5,  6,    8,  0}, /* '7' */
+    { 98,  5,  6,    8,  0}, /* '8' */
+    {103,  5,  6,    8,  0}, /* '9' */
+    {108,  1,  2,    8,  3}, /* ':' */
+    {109,  2,  3,   11,  0}, /* ';' */
+    {111,  4,  5,   11,  0}, /* '<' */
+    {115,  5,  6,   11,  0}, /* '=' */
+    {120,  4,  5,   11,  0}, /* '>' */
+    {124,  5,  6,   11,  0}, /* '?' */
+    {129,  5,  6,   11,  0}, /* '@' */
+    {134,  5,  6,   11,  0}, /* 'A' */
+    {139,  5,  6,   11,  1}, /* 'B' */
+    {144,  5,  6,   12,  2}, /* 'C' */
+    {149,  5,  6,   14,  1}, /* 'D' */
+    {154,  5,  6,   15,  6}, /* 'E' */
+    {159,  5,  6,   21, 27}, /* 'F' */
+    {164,  5,  6,   48,  0}, /* 'G' */
+    {169,  5,  6,   48,  0}, /* 'H' */
+    {174,  3,  4,   48,  6}, /* 'I' */
+    {177,  5,  6,   54, 27}, /* 'J' */
+    {182,  5,  6,   81,  6}, /* 'K' */
+    {187,  5,  6,   87,  9}, /* 'L' */
+    {192,  5,  6,   96,  0}, /* 'M' */
+    {197,  5,  6,   96,  0}, /* 'N' */
+    {202,  5,  6,   96,  1}, /* 'O' */
+    {207,  5,  6,   97,  5}, /* 'P' */
+    {212,  5,  6,  102,  0}, /* 'Q' */
+    {217,  5,  6,  102,  0}, /* 'R' */
+    {222,  5,  6,  102,  1}, /* 'S' */
+    {227,  5,  6,  103, 13}, /* 'T' */
+    {232,  5,  6,  116,  1}, /* 'U' */
+    {237,  5,  6,  117,  1}, /* 'V' */
+    {242,  5,  6,  118,  1}, /* 'W' */
+    {247,  5,  6,  119,  1}, /* 'X' */
+    {252,  5,  6,  120, 13}, /* 'Y' */
+    {257,  5,  6,  133,  3}, /* 'Z' */
+    {262,  4,  5,  136,  0}, /* '[' */
+    {266,  5,  6,  136,  0}, /* '\\' */
+    {271,  4,  5,  136,  0}, /* ']' */
+    {275,  5,  6,  136,  0}, /* '^' */
+    {280,  5,  6,  136,  0}, /* '_' */
+    {285,  3,  4,  136,  0}, /* '`' */
+    {288,  5,  6,  136,  9}, /* 'a' */
+    {293,  5,  6,  145,  3}, /* 'b' */
+    {298,  5,  6,  148,  3}, /* 'c' */
+    {303,  5,  6,  151,  0}, /* 'd' */
+    {308,  5,  6,  151,  5}, /* 'e' */
+    {313,  4,  5,  156, 13}, /* 'f' */
+    {317,  5,  6,  169,  2}, /* 'g' */
+    {322,  5,  6,  171,  2}, /* 'h' */
+    {327,  3,  4,  173,  9}, /* 'i' */
+    {330,  4,  5,  182,  1}, /* 'j' */
+    {334,  4,  5,  183,  0}, /* 'k' */
+    {338,  3,  4,  183,  9}, /* 'l' */
+    {341,  5,  6,  192,  2}, /* 'm' */
+    {346,  5,  6,  194,  2}, /* 'n' */
+    {351,  5,  6,  196,  3}, /* 'o' */
+    {356,  5,  6,  199,  5}, /* 'p' */
+    {361,  5,  6,  204,  0}, /* 'q' */
+    {366,  5,  6,  204, 11}, /* 'r' */
+    {371,  5,  6,  215,  1}, /* 's' */
+    {376,  5,  6,  216,  1}, /* 't' */
+    {381,  5,  6,  217,  0}, /* 'u' */
+    {386,  5,  6,  217,  3}, /* 'v' */
+    {391,  5,  6,  220,  1}, /* 'w' */
+    {396,  5,  6,  221,  0}, /* 'x' */
+    {401,  5,  6,  221,  0}, /* 'y' */
+    {406,  5,  6,  221,  0}, /* 'z' */
+    {411,  3,  4,  221,  0}, /* '{' */
+    {414,  1,  2,  221,  0}, /* '|' */
+    {415,  3,  4,  221,  0}, /* '}' */
+    {418,  5,  6,  221,  0}, /* '~' */
+};
+
+static const ssd1306_atlas_t atlas_8x5 = {
+    8, 1, ' ', '~', atlas_8x5_glyphs, atlas_8x5_cols, atlas_8x5_kern
+};
+
+/* digitos grandes, 16 linhas x 10 colunas, de '-' a ':' */
+static const uint8_t atlas_digits_16_cols[] = {
+    0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01, /* '-' */
+    0x00,0x60,0x00,0x60, /* '.' */
+    0x00,0x60,0x00,0x78,0x00,0x1E,0x80,0x07,0xE0,0x01,0x78,0x00,0x1E,0x00,0x07,0x00,0x01,0x00, /* '/' */
+    0xFE,0x3F,0xFF,0x7F,0x03,0x60,0x03,0x60,0x03,0x60,0x03,0x60,0x03,0x60,0x03,0x60,0xFF,0x7F,0xFE,0x3F, /* '0' */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x3F,0xFE,0x3F, /* '1' */
+    0x80,0x3F,0x83,0x7F,0x83,0x61,0x83,0x61,0x83,0x61,0x83,0x61,0x83,0x61,0x83,0x61,0xFF,0x61,0xFE,0x00, /* '2' */
+    0x00,0x00,0x83,0x61,0x83,0x61,0x83,0x61,0x83,0x61,0x83,0x61,0x83,0x61,0x83,0x61,0xFF,0x7F,0xFE,0x3F, /* '3' */
+    0xFE,0x00,0xFE,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0xFE,0x3F,0xFE,0x3F, /* '4' */
+    0xFE,0x00,0xFF,0x61,0x83,0x61,0x83,0x61,0x83,0x61,0x83,0x61,0x83,0x61,0x83,0x61,0x83,0x7F,0x80,0x3F, /* '5' */
+    0xFE,0x3F,0xFF,0x7F,0x83,0x61,0x83,0x61,0x83,0x61,0x83,0x61,0x83,0x61,0x83,0x61,0x83,0x7F,0x80,0x3F, /* '6' */
+    0x00,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0xFF,0x3F,0xFE,0x3F, /* '7' */
+    0xFE,0x3F,0xFF,0x7F,0x83,0x61,0x83,0x61,0x83,0x61,0x83,0x61,0x83,0x61,0x83,0x61,0xFF,0x7F,0xFE,0x3F, /* '8' */
+    0xFE,0x00,0xFF,0x61,0x83,0x61,0x83,0x61,0x83,0x61,0x83,0x61,0x83,0x61,0x83,0x61,0xFF,0x7F,0xFE,0x3F, /* '9' */
+    0x18,0x0C,0x18,0x0C, /* ':' */
+};
+
+static const ssd1306_glyph_t atlas_digits_16_glyphs[] = {
+    {  0,  8, 10,    0,  0}, /* '-' */
+    {  8,  2,  4,    0,  0}, /* '.' */
+    { 10,  9, 11,    0,  0}, /* '/' */
+    { 19, 10, 12,    0,  0}, /* '0' */
+    { 29, 10, 12,    0,  0}, /* '1' */
+    { 39, 10, 12,    0,  0}, /* '2' */
+    { 49, 10, 12,    0,  0}, /* '3' */
+    { 59, 10, 12,    0,  0}, /* '4' */
+    { 69, 10, 12,    0,  0}, /* '5' */
+    { 79, 10, 12,    0,  0}, /* '6' */
+    { 89, 10, 12,    0,  0}, /* '7' */
+    { 99, 10, 12,    0,  0}, /* '8' */
+    {109, 10, 12,    0,  0}, /* '9' */
+    {119,  2,  4,    0,  0}, /* ':' */
+};
+
+static const ssd1306_atlas_t atlas_digits_16 = {
+    16, 2, '-', ':', atlas_digits_16_glyphs, atlas_digits_16_cols, NULL
+};
+
+#endif
@@ -0,0 +1,92 @@
+/**
+* @file ssd1306_host.h
+*
+* ssd1306 emulator backend for host builds (compile with SSD1306_HOST)
+*
+* decodes the command and data stream sent by the driver into the controller's
+* display RAM, so frames can be checked and dumped without hardware
+*/
+
+#ifndef _inc_ssd1306_host
+#define _inc_ssd1306_host
+
+#include <stdio.h>
+#include "ssd1306.h"
+
+/**
+*	@brief emulated controller state and bus counters
+*/
+typedef struct {
+    uint8_t ram[8][128];	/**< display RAM, [page][column] */
+    uint8_t mem_mode;		/**< 0 horizontal, 1 vertical, 2 page addressing */
+    uint8_t col_start, col_end;	/**< column window */
+    uint8_t page_start, page_end;	/**< page window */
+    uint8_t col, page;		/**< RAM pointer */
+    uint8_t start_line;		/**< display start line */
+    bool scrolling;		/**< SET_SCROLL_ON received */
+    uint8_t scroll[7];		/**< last scroll setup command and its arguments */
+    uint8_t vscroll_top, vscroll_rows;	/**< vertical scroll area */
+    size_t scroll_writes;	/**< bytes written to display RAM while scrolling */
+    uint8_t contrast;		/**< contrast value */
+    bool display_on;		/**< SET_DISP on */
+    bool inverted;		/**< SET_NORM_INV inverted */
+    uint8_t cmd[8];		/**< command being assembled */
+    uint8_t cmd_len;		/**< bytes of cmd received */
+    size_t bytes;		/**< bytes written, control bytes included */
+    size_t transfers;		/**< write transactions */
+    size_t data_bytes;		/**< bytes written to display RAM */
+    size_t cmd_bytes;		/**< command bytes */
+} ssd1306_host_t;
+
+/**
+	@brief transport writing into the emulator, pass it with the ssd1306_host_t to ssd1306_init_backend
+*/
+extern const ssd1306_backend_t ssd1306_host_backend;
+
+/**
+	@brief reset emulator to power-up state
+
+	call before ssd1306_init_backend(p, ..., &ssd1306_host_backend, host)
+
+	@param[in] host : emulator state
+*/
+void ssd1306_host_reset(ssd1306_host_t *host);
+
+/**
+	@brief zero the bus counters
+
+	@param[in] host : emulator state
+*/
+void ssd1306_host_reset_counters(ssd1306_host_t *host);
+
+/**
+	@brief advance an active hardware scroll by one step, as the controller does every few frames
+
+	@param[in] host : emulator state
+*/
+void ssd1306_host_scroll_step(ssd1306_host_t *host);
+
+/**
+	@brief pixel as shown on the panel (start line and inversion applied, off when display is off)
+
+	@param[in] host : emulator state
+	@param[in] x : column
+	@param[in] y : row
+*/
+bool ssd1306_host_pixel(const ssd1306_host_t *host, uint32_t x, uint32_t y);
+
+/**
+	@brief write shown image as binary PBM (P4)
+
+	@param[in] host : emulator state
+	@param[in] width : width of display
+	@param[in] height : height of display
+	@param[in] f : output file
+
+	@return bool.
+	@retval true for Success
+	@retval false on write error
+*/
+bool ssd1306_host_write_pbm(const ssd1306_host_t *host, uint32_t width, uint32_t height, FILE *f);
+
+#endif
@@ -0,0 +1,64 @@
+/**
+* @file ssd1306_i2c.h
+*
+* i2c transport of the ssd1306 driver: asynchronous frames streamed by dma
+*
+* the drawing API and the blocking ssd1306_show are in ssd1306.h
+*/
+
+#ifndef _inc_ssd1306_i2c
+#define _inc_ssd1306_i2c
+
+#include "ssd1306.h"
+
+/**
+	@brief set up asynchronous transfers: claims a dma channel and allocates a staging buffer of (bufsize+1) words
+
+	@param[in] p : instance of display, already initialized
+
+	@return bool.
+	@retval true for Success
+	@retval false if no dma channel or memory is available
+*/
+bool ssd1306_async_init(ssd1306_t *p);
+
+/**
+	@brief like ssd1306_async_init, staging frames in a caller provided buffer
+
+	@param[in] p : instance of display, already initialized
+	@param[in] mem : SSD1306_DMA_WORDS(width, height) words, see SSD1306_STATIC_STORAGE
+	@param[in] len : size of mem in bytes
+
+	@return bool.
+	@retval true for Success
+	@retval false if no dma channel is available or mem is too small
+*/
+bool ssd1306_async_init_static(ssd1306_t *p, uint16_t *mem, size_t len);
+
+/**
+	@brief release dma channel and staging buffer, waits for the frame in flight
+
+	@param[in] p : instance of display
+
+*/
+void ssd1306_async_deinit(ssd1306_t *p);
+
+/**
+	@brief display buffer without blocking, the changed window is copied and streamed by dma
+
+	drawing into the buffer may start as soon as this returns; requires ssd1306_async_init
+
+	@param[in] p : instance of display
+
+*/
+void ssd1306_show_async(ssd1306_t *p);
+
+/**
+	@brief wait until the frame sent by ssd1306_show_async has left the bus
+
+	@param[in] p : instance of display
+
+*/
+void ssd1306_wait(ssd1306_t *p);
+
+#endif
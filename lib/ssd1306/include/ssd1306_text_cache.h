@@ -0,0 +1,101 @@
+/**
+* @file ssd1306_text_cache.h
+*
+* LRU cache of rendered strings: fixed labels ("Terreo:", "Contador:") are
+* rendered once and then copied into the buffer as page columns, only the
+* changing fields go through glyph rendering
+*/
+
+#ifndef _inc_ssd1306_text_cache
+#define _inc_ssd1306_text_cache
+
+#include "ssd1306.h"
+
+/**
+*	@brief number of strings kept
+*/
+#ifndef SSD1306_TEXT_CACHE_ENTRIES
+#define SSD1306_TEXT_CACHE_ENTRIES 8
+#endif
+
+/**
+*	@brief longest string cached, longer ones are drawn directly
+*/
+#ifndef SSD1306_TEXT_CACHE_KEY
+#define SSD1306_TEXT_CACHE_KEY 24
+#endif
+
+/**
+*	@brief bitmap bytes per entry (columns * pages), larger renderings are drawn directly
+*/
+#ifndef SSD1306_TEXT_CACHE_BITMAP
+#define SSD1306_TEXT_CACHE_BITMAP 128
+#endif
+
+/**
+*	@brief one rendered string
+*/
+typedef struct {
+    const void *font;	/**< font_8x5 style array or ssd1306_atlas_t, NULL when unused */
+    uint32_t used;		/**< cache clock at last use */
+    uint8_t scale;		/**< scale rendered at */
+    uint8_t len;		/**< length of text */
+    uint8_t cols;		/**< width of the bitmap */
+    uint8_t pages;		/**< height of the bitmap in pages */
+    uint16_t advance;	/**< pen movement returned by the draw functions */
+    char text[SSD1306_TEXT_CACHE_KEY];	/**< key, not NUL terminated */
+    uint8_t bitmap[SSD1306_TEXT_CACHE_BITMAP];	/**< page layout, see ssd1306_draw_pages */
+} ssd1306_text_entry_t;
+
+/**
+*	@brief cache state, usually a static variable next to the ssd1306_t
+*/
+typedef struct {
+    ssd1306_text_entry_t entries[SSD1306_TEXT_CACHE_ENTRIES];	/**< cached strings */
+    uint32_t clock;		/**< incremented on every lookup */
+    uint32_t hits;		/**< lookups served from the cache */
+    uint32_t misses;	/**< lookups that rendered the string */
+} ssd1306_text_cache_t;
+
+/**
+	@brief empty the cache
+
+	@param[in] cache : cache to reset
+*/
+void ssd1306_text_cache_init(ssd1306_text_cache_t *cache);
+
+/**
+	@brief draw string with given font, reusing the rendering of an earlier call with the same text, font and scale
+
+	same pixels as ssd1306_draw_string_with_font
+
+	@param[in] p : instance of display
+	@param[in] cache : text cache
+	@param[in] x : x starting position of text
+	@param[in] y : y starting position of text
+	@param[in] scale : scale font to n times of original size
+	@param[in] font : pointer to font
+	@param[in] s : text to draw
+
+	@return x where the next character would go
+*/
+uint32_t ssd1306_draw_cached_string_with_font(ssd1306_t *p, ssd1306_text_cache_t *cache, uint32_t x, uint32_t y, uint32_t scale, const uint8_t *font, const char *s);
+
+/**
+	@brief draw string from a font atlas, reusing the rendering of an earlier call with the same text, atlas and scale
+
+	same pixels as ssd1306_draw_string_with_atlas
+
+	@param[in] p : instance of display
+	@param[in] cache : text cache
+	@param[in] x : x starting position of text
+	@param[in] y : y starting position of text
+	@param[in] scale : scale font to n times of original size
+	@param[in] atlas : font atlas
+	@param[in] s : text to draw
+
+	@return x after the last glyph, as ssd1306_draw_string_with_atlas
+*/
+uint32_t ssd1306_draw_cached_string_with_atlas(ssd1306_t *p, ssd1306_text_cache_t *cache, uint32_t x, uint32_t y, uint32_t scale, const ssd1306_atlas_t *atlas, const char *s);
+
+#endif
@@ -0,0 +1,149 @@
+/*
+ * Asynchronous frame transfer for the ssd1306 driver.
+ *
+ * The changed window is copied into a staging buffer of i2c data_cmd words
+ * (data byte plus STOP flag on the last one) and a dma channel paced by the
+ * i2c tx dreq feeds it to the controller. Completion is signalled by the
+ * i2c STOP_DET interrupt, so the buffer can be redrawn while the frame is
+ * still on the bus.
+ */
+
+#include <pico/stdlib.h>
+#include "hardware/i2c.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "ssd1306_i2c.h"
+
+static ssd1306_t *i2c_owner[2];
+
+static void ssd1306_i2c_irq(uint index) {
+    ssd1306_t *p=i2c_owner[index];
+    i2c_hw_t *hw=i2c_get_hw(i2c_get_instance(index));
+
+    if(hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS) {
+        (void) hw->clr_tx_abrt;
+        dma_channel_abort(p->dma_chan);
+        printf("[ssd1306_show_async] transfer aborted!\n");
+    }
+
+    (void) hw->clr_stop_det;
+    hw->intr_mask=0;
+    p->busy=false;
+}
+
+static void ssd1306_i2c0_irq(void) {
+    ssd1306_i2c_irq(0);
+}
+
+static void ssd1306_i2c1_irq(void) {
+    ssd1306_i2c_irq(1);
+}
+
+static bool ssd1306_async_start(ssd1306_t *p, uint16_t *words) {
+    if(p->backend!=NULL || words==NULL)
+        return false;
+
+    const uint index=i2c_hw_index(p->i2c_i);
+    if(i2c_owner[index]!=NULL)
+        return false;
+
+    int chan=dma_claim_unused_channel(false);
+    if(chan<0)
+        return false;
+
+    p->dma_buf=words;
+    p->dma_chan=chan;
+    p->busy=false;
+    i2c_owner[index]=p;
+
+    dma_channel_config c=dma_channel_get_default_config(chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, i2c_get_dreq(p->i2c_i, true));
+    dma_channel_configure(chan, &c, &i2c_get_hw(p->i2c_i)->data_cmd, p->dma_buf, 0, false);
+
+    const uint irq=index?I2C1_IRQ:I2C0_IRQ;
+    i2c_get_hw(p->i2c_i)->intr_mask=0;
+    irq_set_exclusive_handler(irq, index?ssd1306_i2c1_irq:ssd1306_i2c0_irq);
+    irq_set_enabled(irq, true);
+
+    return true;
+}
+
+bool ssd1306_async_init(ssd1306_t *p) {
+    uint16_t *words=malloc((p->bufsize+1)*sizeof(uint16_t));
+
+    if(!ssd1306_async_start(p, words)) {
+        free(words);
+        return false;
+    }
+
+    p->heap|=SSD1306_HEAP_DMA;
+    return true;
+}
+
+bool ssd1306_async_init_static(ssd1306_t *p, uint16_t *mem, size_t len) {
+    if(len<(p->bufsize+1)*sizeof(uint16_t))
+        return false;
+
+    return ssd1306_async_start(p, mem);
+}
+
+void ssd1306_async_deinit(ssd1306_t *p) {
+    if(p->dma_buf==NULL)
+        return;
+
+    ssd1306_wait(p);
+
+    const uint index=i2c_hw_index(p->i2c_i);
+    irq_set_enabled(index?I2C1_IRQ:I2C0_IRQ, false);
+    i2c_owner[index]=NULL;
+
+    dma_channel_unclaim(p->dma_chan);
+    if(p->heap&SSD1306_HEAP_DMA)
+        free(p->dma_buf);
+    p->dma_buf=NULL;
+    p->heap&=~SSD1306_HEAP_DMA;
+}
+
+inline void ssd1306_wait(ssd1306_t *p) {
+    while(p->busy)
+        tight_loop_contents();
+}
+
+void ssd1306_show_async(ssd1306_t *p) {
+    if(p->dma_buf==NULL) {
+        ssd1306_show(p);
+        return;
+    }
+
+    // waits for the previous frame before sending the addressing commands
+    ssd1306_window_t w;
+    if(!ssd1306_show_begin(p, &w))
+        return;
+
+    const size_t cols=w.x1-w.x0+1;
+    uint16_t *dst=p->dma_buf;
+    *dst++=0x40;
+    for(uint8_t page=w.p0; page<=w.p1; ++page) {
+        const uint8_t *src=p->buffer+page*p->width+w.x0;
+        for(size_t i=0; i<cols; ++i)
+            *dst++=src[i];
+    }
+    *(dst-1)|=I2C_IC_DATA_CMD_STOP_BITS;
+
+    i2c_hw_t *hw=i2c_get_hw(p->i2c_i);
+    hw->enable=0;
+    hw->tar=p->address;
+    hw->enable=1;
+
+    (void) hw->clr_stop_det;
+    p->busy=true;
+    hw->intr_mask=I2C_IC_INTR_MASK_M_STOP_DET_BITS|I2C_IC_INTR_MASK_M_TX_ABRT_BITS;
+
+    dma_channel_transfer_from_buffer_now(p->dma_chan, p->dma_buf, dst-p->dma_buf);
+}
@@ -0,0 +1,222 @@
+/*
+ * ssd1306 emulator backend for host builds.
+ *
+ * Every transfer starts with a control byte: 0x00 streams commands, 0x40
+ * streams display data, Co (0x80) set means a single byte follows and then
+ * another control byte.
+ */
+
+#include <string.h>
+
+#include "ssd1306_host.h"
+
+// argument bytes following each command
+static uint8_t ssd1306_host_cmd_args(uint8_t cmd) {
+    switch(cmd) {
+    case SET_CONTRAST:
+    case SET_MEM_ADDR:
+    case SET_MUX_RATIO:
+    case SET_DISP_OFFSET:
+    case SET_COM_PIN_CFG:
+    case SET_DISP_CLK_DIV:
+    case SET_PRECHARGE:
+    case SET_VCOM_DESEL:
+    case SET_CHARGE_PUMP:
+        return 1;
+    case SET_COL_ADDR:
+    case SET_PAGE_ADDR:
+    case SET_VSCROLL_AREA:
+        return 2;
+    case SET_VHSCROLL:
+    case SET_VHSCROLL+1:
+        return 5;
+    case SET_HSCROLL:
+    case SET_HSCROLL+1:
+        return 6;
+    default:
+        return 0;
+    }
+}
+
+static void ssd1306_host_exec(ssd1306_host_t *h) {
+    const uint8_t *c=h->cmd;
+
+    switch(c[0]) {
+    case SET_CONTRAST:
+        h->contrast=c[1];
+        return;
+    case SET_MEM_ADDR:
+        h->mem_mode=c[1]&3;
+        return;
+    case SET_COL_ADDR:
+        h->col_start=h->col=c[1]&0x7f;
+        h->col_end=c[2]&0x7f;
+        return;
+    case SET_PAGE_ADDR:
+        h->page_start=h->page=c[1]&7;
+        h->page_end=c[2]&7;
+        return;
+    case SET_DISP:
+    case SET_DISP|0x01:
+        h->display_on=c[0]&1;
+        return;
+    case SET_NORM_INV:
+    case SET_NORM_INV|0x01:
+        h->inverted=c[0]&1;
+        return;
+    case SET_HSCROLL:
+    case SET_HSCROLL+1:
+    case SET_VHSCROLL:
+    case SET_VHSCROLL+1:
+        memcpy(h->scroll, c, sizeof(h->scroll));
+        return;
+    case SET_SCROLL_OFF:
+    case SET_SCROLL_ON:
+        h->scrolling=c[0]&1;
+        return;
+    case SET_VSCROLL_AREA:
+        h->vscroll_top=c[1]&0x3f;
+        h->vscroll_rows=c[2]&0x7f;
+        return;
+    }
+
+    if(c[0]>=SET_DISP_START_LINE && c[0]<=(SET_DISP_START_LINE|0x3f))
+        h->start_line=c[0]&0x3f;
+    else if(c[0]<=0x0f) // page addressing: lower column nibble
+        h->col=(h->col&0xf0)|(c[0]&0x0f);
+    else if(c[0]<=0x1f) // page addressing: upper column nibble
+        h->col=((c[0]&0x07)<<4)|(h->col&0x0f);
+    else if(c[0]>=0xb0 && c[0]<=0xb7) // page addressing: page
+        h->page=c[0]&7;
+}
+
+static void ssd1306_host_cmd_byte(ssd1306_host_t *h, uint8_t b) {
+    ++h->cmd_bytes;
+    h->cmd[h->cmd_len++]=b;
+    if(h->cmd_len>ssd1306_host_cmd_args(h->cmd[0])) {
+        ssd1306_host_exec(h);
+        h->cmd_len=0;
+    }
+}
+
+static void ssd1306_host_data_byte(ssd1306_host_t *h, uint8_t b) {
+    ++h->data_bytes;
+    if(h->scrolling)
+        ++h->scroll_writes;
+    h->ram[h->page][h->col]=b;
+
+    switch(h->mem_mode) {
+    case 0: // horizontal: next column, wrap to next page of the window
+        if(h->col++==h->col_end) {
+            h->col=h->col_start;
+            h->page=h->page==h->page_end?h->page_start:h->page+1;
+        }
+        break;
+    case 1: // vertical: next page, wrap to next column of the window
+        if(h->page++==h->page_end) {
+            h->page=h->page_start;
+            h->col=h->col==h->col_end?h->col_start:h->col+1;
+        }
+        break;
+    default: // page: stays on the page
+        h->col=(h->col+1)&0x7f;
+        break;
+    }
+}
+
+static int ssd1306_host_write(void *ctx, uint8_t addr, const uint8_t *src, size_t len) {
+    ssd1306_host_t *h=ctx;
+    (void) addr;
+
+    h->bytes+=len;
+    ++h->transfers;
+
+    for(size_t i=0; i<len;) {
+        const uint8_t control=src[i++];
+        const bool single=control&0x80;
+        const bool data=control&0x40;
+        const size_t end=single?(i+1<len?i+1:len):len;
+
+        for(; i<end; ++i) {
+            if(data)
+                ssd1306_host_data_byte(h, src[i]);
+            else
+                ssd1306_host_cmd_byte(h, src[i]);
+        }
+    }
+    return (int) len;
+}
+
+const ssd1306_backend_t ssd1306_host_backend= {
+    .write=ssd1306_host_write,
+};
+
+void ssd1306_host_reset(ssd1306_host_t *host) {
+    memset(host, 0, sizeof(*host));
+    host->col_end=127;
+    host->page_end=7;
+    host->mem_mode=2;
+    host->contrast=0x7f;
+    host->vscroll_rows=64;
+}
+
+void ssd1306_host_reset_counters(ssd1306_host_t *host) {
+    host->bytes=host->transfers=host->data_bytes=host->cmd_bytes=0;
+}
+
+void ssd1306_host_scroll_step(ssd1306_host_t *h) {
+    if(!h->scrolling)
+        return;
+
+    const uint8_t cmd=h->scroll[0];
+    const bool left=cmd==SET_HSCROLL+1 || cmd==SET_VHSCROLL+1;
+    const bool vertical=cmd>=SET_VHSCROLL;
+    const uint8_t p0=h->scroll[2]&7, p1=h->scroll[4]&7;
+
+    // horizontal part: the controller rotates the columns of the scrolled pages in RAM
+    for(uint8_t page=p0; page<=p1; ++page) {
+        uint8_t *row=h->ram[page];
+        if(left) {
+            const uint8_t first=row[0];
+            memmove(row, row+1, 127);
+            row[127]=first;
+        } else {
+            const uint8_t last=row[127];
+            memmove(row+1, row, 127);
+            row[0]=last;
+        }
+    }
+
+    // vertical part: the start line moves inside the scroll area
+    if(vertical && h->vscroll_rows) {
+        const uint8_t top=h->vscroll_top;
+        const uint8_t line=h->start_line<top?top:h->start_line;
+        h->start_line=top+(line-top+(h->scroll[5]&0x3f))%h->vscroll_rows;
+    }
+}
+
+bool ssd1306_host_pixel(const ssd1306_host_t *host, uint32_t x, uint32_t y) {
+    if(!host->display_on || x>=128 || y>=64)
+        return false;
+
+    const uint32_t line=(y+host->start_line)&63;
+    const bool on=(host->ram[line>>3][x]>>(line&7))&1;
+    return on!=host->inverted;
+}
+
+bool ssd1306_host_write_pbm(const ssd1306_host_t *host, uint32_t width, uint32_t height, FILE *f) {
+    const uint32_t col_offset=width==64?32:0;
+
+    if(fprintf(f, "P4\n%u %u\n", (unsigned) width, (unsigned) height)<0)
+        return false;
+
+    for(uint32_t y=0; y<height; ++y) {
+        uint8_t row[16]= {0};
+        for(uint32_t x=0; x<width; ++x)
+            if(ssd1306_host_pixel(host, x+col_offset, y))
+                row[x>>3]|=0x80>>(x&7);
+        if(fwrite(row, 1, (width+7)/8, f)!=(width+7)/8)
+            return false;
+    }
+    return true;
+}
@@ -0,0 +1,1058 @@
+/*
+
+MIT License
+
+Copyright (c) 2021 David Schramm
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifdef SSD1306_HOST
+// host builds (tests, emulator backend) have no SDK
+#define PICO_ERROR_GENERIC (-1)
+#define PICO_ERROR_TIMEOUT (-2)
+#define tight_loop_contents() ((void) 0)
+#else
+#include <pico/stdlib.h>
+#include "hardware/i2c.h"
+#include <pico/binary_info.h>
+#endif
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "ssd1306.h"
+#include "ssd1306_font.h"
+
+inline static void swap(int32_t *a, int32_t *b) {
+    int32_t t=*a;
+    *a=*b;
+    *b=t;
+}
+
+#define SSD1306_WINDOW_EMPTY ((ssd1306_window_t) {0xff, 0, 0xff, 0})
+
+inline static bool ssd1306_window_is_empty(const ssd1306_window_t *w) {
+    return w->x0>w->x1 || w->p0>w->p1;
+}
+
+inline static void ssd1306_window_add(ssd1306_window_t *w, uint32_t x0, uint32_t x1, uint32_t p0, uint32_t p1) {
+    if(ssd1306_window_is_empty(w)) {
+        *w=(ssd1306_window_t) {x0, x1, p0, p1};
+        return;
+    }
+    if(x0<w->x0) w->x0=x0;
+    if(x1>w->x1) w->x1=x1;
+    if(p0<w->p0) w->p0=p0;
+    if(p1>w->p1) w->p1=p1;
+}
+
+// area [x0..x1]x[p0..p1] had pixels set
+inline static void ssd1306_mark_ink(ssd1306_t *p, uint32_t x0, uint32_t x1, uint32_t p0, uint32_t p1) {
+    ssd1306_window_add(&p->dirty, x0, x1, p0, p1);
+    ssd1306_window_add(&p->ink, x0, x1, p0, p1);
+}
+
+inline static int ssd1306_bus_write(ssd1306_t *p, const uint8_t *src, size_t len) {
+    if(p->backend!=NULL)
+        return p->backend->write(p->backend_ctx, p->address, src, len);
+#ifdef SSD1306_HOST
+    return PICO_ERROR_GENERIC;
+#else
+    return i2c_write_blocking(p->i2c_i, p->address, src, len, false);
+#endif
+}
+
+inline static void fancy_write(ssd1306_t *p, const uint8_t *src, size_t len, char *name) {
+    switch(ssd1306_bus_write(p, src, len)) {
+    case PICO_ERROR_GENERIC:
+        printf("[%s] addr not acknowledged!\n", name);
+        break;
+    case PICO_ERROR_TIMEOUT:
+        printf("[%s] timeout!\n", name);
+        break;
+    default:
+        //printf("[%s] wrote successfully %lu bytes!\n", name, len);
+        break;
+    }
+}
+
+// an asynchronous frame owns the bus until its stop condition
+inline static void ssd1306_wait_bus(ssd1306_t *p) {
+    while(p->busy)
+        tight_loop_contents();
+}
+
+void ssd1306_write_cmds(ssd1306_t *p, const uint8_t *cmds, size_t len) {
+    // 0x00 control byte: every following byte of the transfer is a command
+    uint8_t d[1+SSD1306_CMD_CHUNK]= {0x00};
+
+    ssd1306_wait_bus(p);
+    while(len) {
+        const size_t n=len<SSD1306_CMD_CHUNK?len:SSD1306_CMD_CHUNK;
+        memcpy(d+1, cmds, n);
+        fancy_write(p, d, n+1, "ssd1306_write_cmds");
+        cmds+=n;
+        len-=n;
+    }
+}
+
+inline static void ssd1306_write(ssd1306_t *p, uint8_t val) {
+    ssd1306_write_cmds(p, &val, 1);
+}
+
+// sets every field the bus and show paths read, p may hold garbage (stack or reused struct)
+static void ssd1306_setup(ssd1306_t *p, uint16_t width, uint16_t height, uint8_t address, i2c_inst_t *i2c_instance,
+                          const ssd1306_backend_t *backend, void *backend_ctx) {
+    p->width=width;
+    p->height=height;
+    p->pages=height/8;
+    p->address=address;
+
+    p->i2c_i=i2c_instance;
+    p->backend=backend;
+    p->backend_ctx=backend_ctx;
+    p->dma_buf=NULL;
+    p->shadow=NULL;
+    p->busy=false;
+    p->heap=0;
+    p->start_line=0;
+    p->scrolling=false;
+
+    p->bufsize=(p->pages)*(p->width);
+}
+
+static bool ssd1306_start(ssd1306_t *p) {
+    const uint16_t width=p->width, height=p->height;
+
+    // display RAM content is unknown after power-up, first show sends everything
+    ssd1306_invalidate(p);
+
+    // from https://github.com/makerportal/rpi-pico-ssd1306
+    uint8_t cmds[]= {
+        SET_DISP,
+        // timing and driving scheme
+        SET_DISP_CLK_DIV,
+        0x80,
+        SET_MUX_RATIO,
+        height - 1,
+        SET_DISP_OFFSET,
+        0x00,
+        // resolution and layout
+        SET_DISP_START_LINE,
+        // charge pump
+        SET_CHARGE_PUMP,
+        p->external_vcc?0x10:0x14,
+        SET_SEG_REMAP | 0x01,           // column addr 127 mapped to SEG0
+        SET_COM_OUT_DIR | 0x08,         // scan from COM[N] to COM0
+        SET_COM_PIN_CFG,
+        width>2*height?0x02:0x12,
+        // display
+        SET_CONTRAST,
+        0xff,
+        SET_PRECHARGE,
+        p->external_vcc?0x22:0xF1,
+        SET_VCOM_DESEL,
+        0x30,                           // or 0x40?
+        SET_ENTIRE_ON,                  // output follows RAM contents
+        SET_NORM_INV,                   // not inverted
+        SET_DISP | 0x01,
+        // address setting
+        SET_MEM_ADDR,
+        0x00,  // horizontal
+    };
+
+    ssd1306_write_cmds(p, cmds, sizeof(cmds));
+
+    return true;
+}
+
+static bool ssd1306_alloc(ssd1306_t *p) {
+    // 4 extra bytes keep the buffer word aligned for ssd1306_show diffing, the last one holds the 0x40 control byte
+    if((p->buffer=malloc(p->bufsize+4))==NULL) {
+        p->bufsize=0;
+        return false;
+    }
+
+    p->buffer+=4;
+    p->heap=SSD1306_HEAP_BUFFER;
+
+    return ssd1306_start(p);
+}
+
+static bool ssd1306_use(ssd1306_t *p, uint32_t *mem, size_t len) {
+    // same layout as ssd1306_init: first word for the control byte, then the frame
+    if(mem==NULL || len<p->bufsize+4) {
+        p->buffer=NULL;
+        p->bufsize=0;
+        return false;
+    }
+
+    p->buffer=(uint8_t *)(mem+1);
+
+    return ssd1306_start(p);
+}
+
+bool ssd1306_init(ssd1306_t *p, uint16_t width, uint16_t height, uint8_t address, i2c_inst_t *i2c_instance) {
+    ssd1306_setup(p, width, height, address, i2c_instance, NULL, NULL);
+    return ssd1306_alloc(p);
+}
+
+bool ssd1306_init_static(ssd1306_t *p, uint16_t width, uint16_t height, uint8_t address, i2c_inst_t *i2c_instance, uint32_t *mem, size_t len) {
+    ssd1306_setup(p, width, height, address, i2c_instance, NULL, NULL);
+    return ssd1306_use(p, mem, len);
+}
+
+bool ssd1306_init_backend(ssd1306_t *p, uint16_t width, uint16_t height, uint8_t address, const ssd1306_backend_t *backend, void *backend_ctx) {
+    ssd1306_setup(p, width, height, address, NULL, backend, backend_ctx);
+    return ssd1306_alloc(p);
+}
+
+bool ssd1306_init_backend_static(ssd1306_t *p, uint16_t width, uint16_t height, uint8_t address, const ssd1306_backend_t *backend, void *backend_ctx, uint32_t *mem, size_t len) {
+    ssd1306_setup(p, width, height, address, NULL, backend, backend_ctx);
+    return ssd1306_use(p, mem, len);
+}
+
+inline void ssd1306_deinit(ssd1306_t *p) {
+    ssd1306_shadow_deinit(p);
+    if(p->heap&SSD1306_HEAP_BUFFER)
+        free(p->buffer-4);
+    p->buffer=NULL;
+    p->heap&=~SSD1306_HEAP_BUFFER;
+}
+
+static bool ssd1306_shadow_start(ssd1306_t *p, uint8_t *shadow) {
+    if(shadow==NULL)
+        return false;
+
+    p->shadow=shadow;
+    // shadow is only trusted after a full frame went out
+    ssd1306_invalidate(p);
+    return true;
+}
+
+bool ssd1306_shadow_init(ssd1306_t *p) {
+    if(p->shadow!=NULL)
+        return true;
+
+    if(!ssd1306_shadow_start(p, malloc(p->bufsize)))
+        return false;
+
+    p->heap|=SSD1306_HEAP_SHADOW;
+    return true;
+}
+
+bool ssd1306_shadow_init_static(ssd1306_t *p, uint8_t *mem, size_t len) {
+    if(p->shadow!=NULL)
+        return true;
+
+    // ssd1306_diff_page compares 32 bit words: an unaligned load HardFaults on the M0+
+    if(len<p->bufsize || ((uintptr_t) mem&3))
+        return false;
+
+    return ssd1306_shadow_start(p, mem);
+}
+
+void ssd1306_shadow_deinit(ssd1306_t *p) {
+    if(p->heap&SSD1306_HEAP_SHADOW)
+        free(p->shadow);
+    p->shadow=NULL;
+    p->heap&=~SSD1306_HEAP_SHADOW;
+}
+
+inline void ssd1306_poweroff(ssd1306_t *p) {
+    ssd1306_write(p, SET_DISP|0x00);
+}
+
+inline void ssd1306_poweron(ssd1306_t *p) {
+    ssd1306_write(p, SET_DISP|0x01);
+}
+
+inline void ssd1306_contrast(ssd1306_t *p, uint8_t val) {
+    const uint8_t cmds[]= {SET_CONTRAST, val};
+    ssd1306_write_cmds(p, cmds, sizeof(cmds));
+}
+
+inline void ssd1306_invert(ssd1306_t *p, uint8_t inv) {
+    ssd1306_write(p, SET_NORM_INV | (inv & 1));
+}
+
+void ssd1306_start_line(ssd1306_t *p, uint8_t line) {
+    p->start_line=line&0x3f;
+    ssd1306_write(p, SET_DISP_START_LINE|p->start_line);
+}
+
+void ssd1306_scroll(ssd1306_t *p, ssd1306_scroll_dir_t dir, uint8_t p0, uint8_t p1, ssd1306_scroll_speed_t speed, uint8_t vertical) {
+    const uint8_t last=p->pages-1;
+    const uint8_t left=dir==SSD1306_SCROLL_LEFT;
+    // scroll parameters may only be changed while scrolling is off
+    uint8_t cmds[10]= {SET_SCROLL_OFF};
+    size_t len=1;
+
+    cmds[len++]=(vertical?SET_VHSCROLL:SET_HSCROLL)+left;
+    cmds[len++]=0x00;   // dummy
+    cmds[len++]=p0>last?last:p0;
+    cmds[len++]=speed&0x07;
+    cmds[len++]=p1>last?last:p1;
+    if(vertical) {
+        cmds[len++]=vertical&0x3f;
+    } else {
+        cmds[len++]=0x00;   // dummy
+        cmds[len++]=0xFF;   // dummy
+    }
+    cmds[len++]=SET_SCROLL_ON;
+
+    ssd1306_write_cmds(p, cmds, len);
+    p->scrolling=true;
+}
+
+void ssd1306_scroll_area(ssd1306_t *p, uint8_t top, uint8_t rows) {
+    const uint8_t cmds[]= {SET_VSCROLL_AREA, top&0x3f, rows&0x7f};
+    ssd1306_write_cmds(p, cmds, sizeof(cmds));
+}
+
+void ssd1306_scroll_stop(ssd1306_t *p) {
+    ssd1306_write(p, SET_SCROLL_OFF);
+    p->scrolling=false;
+    ssd1306_invalidate(p);
+}
+
+inline void ssd1306_clear(ssd1306_t *p) {
+    memset(p->buffer, 0, p->bufsize);
+
+    // only the area that was drawn on needs to be blanked on the display
+    if(!ssd1306_window_is_empty(&p->ink))
+        ssd1306_window_add(&p->dirty, p->ink.x0, p->ink.x1, p->ink.p0, p->ink.p1);
+    p->ink=SSD1306_WINDOW_EMPTY;
+}
+
+void ssd1306_invalidate(ssd1306_t *p) {
+    p->dirty=(ssd1306_window_t) {0, p->width-1, 0, p->pages-1};
+    p->ink=p->dirty;
+    p->resend=true;
+}
+
+void ssd1306_clear_pixel(ssd1306_t *p, uint32_t x, uint32_t y) {
+    if(x>=p->width || y>=p->height) return;
+
+    p->buffer[x+p->width*(y>>3)]&=~(0x1<<(y&0x07));
+    ssd1306_window_add(&p->dirty, x, x, y>>3, y>>3);
+}
+
+void ssd1306_draw_pixel(ssd1306_t *p, uint32_t x, uint32_t y) {
+    if(x>=p->width || y>=p->height) return;
+
+    p->buffer[x+p->width*(y>>3)]|=0x1<<(y&0x07); // y>>3==y/8 && y&0x7==y%8
+    ssd1306_mark_ink(p, x, x, y>>3, y>>3);
+}
+
+// Cohen-Sutherland region codes
+enum {
+    SSD1306_CLIP_LEFT=1,
+    SSD1306_CLIP_RIGHT=2,
+    SSD1306_CLIP_TOP=4,
+    SSD1306_CLIP_BOTTOM=8,
+};
+
+inline static uint8_t ssd1306_outcode(const ssd1306_t *p, int32_t x, int32_t y) {
+    uint8_t code=0;
+    if(x<0) code|=SSD1306_CLIP_LEFT;
+    else if(x>=p->width) code|=SSD1306_CLIP_RIGHT;
+    if(y<0) code|=SSD1306_CLIP_TOP;
+    else if(y>=p->height) code|=SSD1306_CLIP_BOTTOM;
+    return code;
+}
+
+// n/d rounded to nearest
+inline static int32_t ssd1306_div_round(int64_t n, int64_t d) {
+    if(d<0) {
+        n=-n;
+        d=-d;
+    }
+    return n>=0?(n+d/2)/d:-((-n+d/2)/d);
+}
+
+// clips the segment to the display, returns false if nothing is left;
+// intersections are taken on the original line so rounding does not accumulate
+static bool ssd1306_clip_line(const ssd1306_t *p, int32_t *x1, int32_t *y1, int32_t *x2, int32_t *y2) {
+    const int32_t ox=*x1, oy=*y1;
+    const int64_t dx=*x2-*x1, dy=*y2-*y1;
+    uint8_t c1=ssd1306_outcode(p, *x1, *y1);
+    uint8_t c2=ssd1306_outcode(p, *x2, *y2);
+
+    // each end point needs at most two clips, more means the line only grazes a corner
+    for(uint8_t i=0; c1|c2; ++i) {
+        if((c1&c2) || i==4)
+            return false;
+
+        const uint8_t out=c1?c1:c2;
+        int32_t x, y;
+
+        if(out&SSD1306_CLIP_TOP) {
+            y=0;
+            x=ox+ssd1306_div_round(dx*(y-oy), dy);
+        } else if(out&SSD1306_CLIP_BOTTOM) {
+            y=p->height-1;
+            x=ox+ssd1306_div_round(dx*(y-oy), dy);
+        } else if(out&SSD1306_CLIP_LEFT) {
+            x=0;
+            y=oy+ssd1306_div_round(dy*(x-ox), dx);
+        } else {
+            x=p->width-1;
+            y=oy+ssd1306_div_round(dy*(x-ox), dx);
+        }
+
+        if(out==c1) {
+            *x1=x;
+            *y1=y;
+            c1=ssd1306_outcode(p, x, y);
+        } else {
+            *x2=x;
+            *y2=y;
+            c2=ssd1306_outcode(p, x, y);
+        }
+    }
+    return true;
+}
+
+void ssd1306_draw_line(ssd1306_t *p, int32_t x1, int32_t y1, int32_t x2, int32_t y2) {
+    if(!ssd1306_clip_line(p, &x1, &y1, &x2, &y2))
+        return;
+
+    if(x1>x2) {
+        swap(&x1, &x2);
+        swap(&y1, &y2);
+    }
+
+    // horizontal and vertical lines are spans
+    if(y1==y2) {
+        ssd1306_fill_square(p, x1, y1, x2-x1+1, 1, SSD1306_FILL_SET);
+        return;
+    }
+    if(x1==x2) {
+        if(y1>y2)
+            swap(&y1, &y2);
+        ssd1306_fill_square(p, x1, y1, 1, y2-y1+1, SSD1306_FILL_SET);
+        return;
+    }
+
+    // integer Bresenham, both end points are on the display after clipping
+    const int32_t dx=x2-x1;
+    const int32_t dy=y1<y2?y1-y2:y2-y1;
+    const int32_t sy=y1<y2?1:-1;
+    int32_t err=dx+dy;
+
+    ssd1306_mark_ink(p, x1, x2, (sy>0?y1:y2)>>3, (sy>0?y2:y1)>>3);
+
+    // walk the buffer with a pointer and a bit mask instead of recomputing the pixel address
+    uint8_t *dst=p->buffer+x1+p->width*(y1>>3);
+    uint8_t bit=0x1<<(y1&0x07);
+    for(;;) {
+        *dst|=bit;
+        if(x1==x2 && y1==y2)
+            break;
+
+        const int32_t e2=2*err;
+        if(e2>=dy) {
+            err+=dy;
+            ++x1;
+            ++dst;
+        }
+        if(e2<=dx) {
+            err+=dx;
+            y1+=sy;
+            if(sy>0 && !(bit<<=1)) {
+                bit=0x01;
+                dst+=p->width;
+            } else if(sy<0 && !(bit>>=1)) {
+                bit=0x80;
+                dst-=p->width;
+            }
+        }
+    }
+}
+
+void ssd1306_fill_square(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t width, uint32_t height, ssd1306_fill_mode_t mode) {
+    if(x>=p->width || y>=p->height || !width || !height) return;
+
+    const uint32_t x1=width>p->width-x?p->width-1u:x+width-1;
+    const uint32_t y1=height>p->height-y?p->height-1u:y+height-1;
+    const uint32_t p0=y>>3, p1=y1>>3;
+    const uint32_t cols=x1-x+1;
+
+    // partial top and bottom pages get masks, the pages in between are whole bytes
+    const uint8_t top=0xff<<(y&7);
+    const uint8_t bottom=0xff>>(7-(y1&7));
+
+    uint8_t *row=p->buffer+p0*p->width+x;
+    for(uint32_t page=p0; page<=p1; ++page, row+=p->width) {
+        uint8_t mask=0xff;
+        if(page==p0) mask&=top;
+        if(page==p1) mask&=bottom;
+
+        switch(mode) {
+        case SSD1306_FILL_SET:
+            if(mask==0xff)
+                memset(row, 0xff, cols);
+            else
+                for(uint32_t i=0; i<cols; ++i) row[i]|=mask;
+            break;
+        case SSD1306_FILL_CLEAR:
+            if(mask==0xff)
+                memset(row, 0x00, cols);
+            else
+                for(uint32_t i=0; i<cols; ++i) row[i]&=~mask;
+            break;
+        case SSD1306_FILL_XOR:
+            for(uint32_t i=0; i<cols; ++i) row[i]^=mask;
+            break;
+        }
+    }
+
+    if(mode==SSD1306_FILL_CLEAR)
+        ssd1306_window_add(&p->dirty, x, x1, p0, p1);
+    else
+        ssd1306_mark_ink(p, x, x1, p0, p1);
+}
+
+void ssd1306_clear_square(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+    ssd1306_fill_square(p, x, y, width, height, SSD1306_FILL_CLEAR);
+}
+
+void ssd1306_draw_square(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+    ssd1306_fill_square(p, x, y, width, height, SSD1306_FILL_SET);
+}
+
+void ssd1306_draw_empty_square(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+    ssd1306_draw_line(p, x, y, x+width, y);
+    ssd1306_draw_line(p, x, y+height, x+width, y+height);
+    ssd1306_draw_line(p, x, y, x, y+height);
+    ssd1306_draw_line(p, x+width, y, x+width, y+height);
+}
+
+// ORs a glyph part (one byte per column, bit 0 on top) into the buffer at row y,
+// two shifted writes per column when y is not page aligned
+static void ssd1306_blit_part(ssd1306_t *p, uint32_t x, uint32_t y, const uint8_t *src, uint32_t stride, uint32_t cols) {
+    const uint32_t page=y>>3;
+    const uint32_t shift=y&7;
+    uint8_t *dst=p->buffer+page*p->width+x;
+
+    if(page>=p->pages)
+        return;
+
+    if(!shift) {
+        for(uint32_t w=0; w<cols; ++w, src+=stride)
+            dst[w]|=*src;
+        return;
+    }
+
+    uint8_t *below=page+1<p->pages?dst+p->width:NULL;
+    for(uint32_t w=0; w<cols; ++w, src+=stride) {
+        dst[w]|=*src<<shift;
+        if(below)
+            below[w]|=*src>>(8-shift);
+    }
+}
+
+void ssd1306_draw_pages(ssd1306_t *p, uint32_t x, uint32_t y, const uint8_t *src, uint32_t cols, uint32_t pages) {
+    if(x>=p->width || y>=p->height || !cols || !pages)
+        return;
+
+    const uint32_t visible=x+cols>p->width?p->width-x:cols;
+    for(uint32_t lp=0; lp<pages; ++lp, src+=cols)
+        ssd1306_blit_part(p, x, y+(lp<<3), src, 1, visible);
+
+    uint32_t last_page=(y+(pages<<3)-1)>>3;
+    if(last_page>=p->pages)
+        last_page=p->pages-1;
+    ssd1306_mark_ink(p, x, x+visible-1, y>>3, last_page);
+}
+
+void ssd1306_draw_char_with_font(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, const uint8_t *font, char c) {
+    if(c<font[3]||c>font[4])
+        return;
+
+    uint32_t parts_per_line=(font[0]>>3)+((font[0]&7)>0);
+
+    // scale 1: each glyph part is one byte of a page column, no per-pixel work
+    if(scale==1) {
+        if(x>=p->width || y>=p->height)
+            return;
+
+        const uint8_t *glyph=font+5+(c-font[3])*font[1]*parts_per_line;
+        const uint32_t cols=x+font[1]>p->width?p->width-x:font[1];
+        for(uint32_t lp=0; lp<parts_per_line; ++lp)
+            ssd1306_blit_part(p, x, y+(lp<<3), glyph+lp, parts_per_line, cols);
+
+        uint32_t last_page=(y+font[0]-1)>>3;
+        if(last_page>=p->pages)
+            last_page=p->pages-1;
+        ssd1306_mark_ink(p, x, x+cols-1, y>>3, last_page);
+        return;
+    }
+
+    for(uint8_t w=0; w<font[1]; ++w) { // width
+        uint32_t pp=(c-font[3])*font[1]*parts_per_line+w*parts_per_line+5;
+        for(uint32_t lp=0; lp<parts_per_line; ++lp) {
+            uint8_t line=font[pp];
+
+            for(int8_t j=0; j<8; ++j, line>>=1) {
+                if(line & 1)
+                    ssd1306_draw_square(p, x+w*scale, y+((lp<<3)+j)*scale, scale, scale);
+            }
+
+            ++pp;
+        }
+    }
+}
+
+void ssd1306_draw_string_with_font(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, const uint8_t *font, const char *s) {
+    for(int32_t x_n=x; *s; x_n+=(font[1]+font[2])*scale) {
+        ssd1306_draw_char_with_font(p, x_n, y, scale, font, *(s++));
+    }
+}
+
+static inline const ssd1306_glyph_t *ssd1306_atlas_glyph(const ssd1306_atlas_t *atlas, char c) {
+    if(c<atlas->first || c>atlas->last)
+        return NULL;
+    return atlas->glyphs+(c-atlas->first);
+}
+
+static inline uint32_t ssd1306_atlas_column(const uint8_t *col, uint8_t parts) {
+    uint32_t bits=0;
+    for(uint8_t lp=0; lp<parts; ++lp)
+        bits|=(uint32_t) col[lp]<<(lp<<3);
+    return bits;
+}
+
+static int32_t ssd1306_atlas_kern(const ssd1306_atlas_t *atlas, const ssd1306_glyph_t *g, char next) {
+    const ssd1306_kern_t *k=atlas->kern+g->kern;
+    for(uint8_t i=0; i<g->kern_count; ++i)
+        if(k[i].right==next)
+            return k[i].adjust;
+    return 0;
+}
+
+// draws a glyph whose top left corner is inside the display; scale 1 leaves marking ink to the caller
+static void ssd1306_atlas_blit(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, const ssd1306_atlas_t *atlas, const ssd1306_glyph_t *g) {
+    const uint8_t parts=atlas->parts;
+    const uint8_t *col=atlas->cols+g->offset*parts;
+
+    if(scale==1) {
+        const uint32_t cols=x+g->width>p->width?p->width-x:g->width;
+        for(uint32_t lp=0; lp<parts; ++lp)
+            ssd1306_blit_part(p, x, y+(lp<<3), col+lp, parts, cols);
+        return;
+    }
+
+    // one square per run of set rows, spanning the identical columns that follow
+    for(uint32_t w=0; w<g->width;) {
+        uint32_t bits=ssd1306_atlas_column(col+w*parts, parts);
+        uint32_t n=1;
+        while(w+n<g->width && ssd1306_atlas_column(col+(w+n)*parts, parts)==bits)
+            ++n;
+
+        for(uint32_t row=0; bits;) {
+            const uint32_t skip=__builtin_ctz(bits);
+            bits>>=skip;
+            row+=skip;
+            const uint32_t run=~bits?__builtin_ctz(~bits):32;
+            ssd1306_fill_square(p, x+w*scale, y+row*scale, n*scale, run*scale, SSD1306_FILL_SET);
+            bits=run<32?bits>>run:0;
+            row+=run;
+        }
+        w+=n;
+    }
+}
+
+static void ssd1306_atlas_mark(ssd1306_t *p, uint32_t x0, uint32_t x1, uint32_t y, const ssd1306_atlas_t *atlas) {
+    uint32_t last_page=(y+atlas->height-1)>>3;
+    if(last_page>=p->pages)
+        last_page=p->pages-1;
+    if(x1>=p->width)
+        x1=p->width-1;
+    ssd1306_mark_ink(p, x0, x1, y>>3, last_page);
+}
+
+uint32_t ssd1306_draw_char_with_atlas(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, const ssd1306_atlas_t *atlas, char c) {
+    const ssd1306_glyph_t *g=ssd1306_atlas_glyph(atlas, c);
+    if(g==NULL)
+        return 0;
+    if(!g->width || x>=p->width || y>=p->height)
+        return g->advance*scale;
+
+    ssd1306_atlas_blit(p, x, y, scale, atlas, g);
+    if(scale==1)
+        ssd1306_atlas_mark(p, x, x+g->width-1, y, atlas);
+    return g->advance*scale;
+}
+
+uint32_t ssd1306_draw_string_with_atlas(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, const ssd1306_atlas_t *atlas, const char *s) {
+    uint32_t x0=UINT32_MAX, x1=0;
+
+    for(; *s; ++s) {
+        const ssd1306_glyph_t *g=ssd1306_atlas_glyph(atlas, *s);
+        if(g==NULL)
+            continue;
+
+        if(g->width && x<p->width && y<p->height) {
+            ssd1306_atlas_blit(p, x, y, scale, atlas, g);
+            if(x<x0)
+                x0=x;
+            x1=x+g->width-1;
+        }
+        x+=g->advance*scale;
+        if(g->kern_count)
+            x+=ssd1306_atlas_kern(atlas, g, s[1])*(int32_t) scale;
+    }
+
+    // scale 1 blits skip the per glyph bookkeeping, the whole line is marked once
+    if(scale==1 && x0<=x1)
+        ssd1306_atlas_mark(p, x0, x1, y, atlas);
+    return x;
+}
+
+uint32_t ssd1306_string_width_with_atlas(const ssd1306_atlas_t *atlas, uint32_t scale, const char *s) {
+    uint32_t pen=0, end=0;
+    for(; *s; ++s) {
+        const ssd1306_glyph_t *g=ssd1306_atlas_glyph(atlas, *s);
+        if(g==NULL)
+            continue;
+        if(pen+g->width*scale>end)
+            end=pen+g->width*scale;
+        pen+=g->advance*scale;
+        if(g->kern_count)
+            pen+=ssd1306_atlas_kern(atlas, g, s[1])*(int32_t) scale;
+    }
+    return end;
+}
+
+void ssd1306_draw_char(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, char c) {
+    ssd1306_draw_char_with_font(p, x, y, scale, font_8x5, c);
+}
+
+void ssd1306_draw_string(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, const char *s) {
+    ssd1306_draw_string_with_font(p, x, y, scale, font_8x5, s);
+}
+
+static inline uint32_t ssd1306_bmp_get_val(const uint8_t *data, const size_t offset, uint8_t size) {
+    switch(size) {
+    case 1:
+        return data[offset];
+    case 2:
+        return data[offset]|(data[offset+1]<<8);
+    case 4:
+        return data[offset]|(data[offset+1]<<8)|(data[offset+2]<<16)|(data[offset+3]<<24);
+    default:
+        __builtin_unreachable();
+    }
+    __builtin_unreachable();
+}
+
+void ssd1306_bmp_show_image_with_offset(ssd1306_t *p, const uint8_t *data, const long size, uint32_t x_offset, uint32_t y_offset) {
+    if(size<54) // data smaller than header
+        return;
+
+    const uint32_t bfOffBits=ssd1306_bmp_get_val(data, 10, 4);
+    const uint32_t biSize=ssd1306_bmp_get_val(data, 14, 4);
+    const uint32_t biWidth=ssd1306_bmp_get_val(data, 18, 4);
+    const int32_t biHeight=(int32_t) ssd1306_bmp_get_val(data, 22, 4);
+    const uint16_t biBitCount=(uint16_t) ssd1306_bmp_get_val(data, 28, 2);
+    const uint32_t biCompression=ssd1306_bmp_get_val(data, 30, 4);
+
+    if(biBitCount!=1) // image not monochrome
+        return;
+
+    if(biCompression!=0) // image compressed
+        return;
+
+    const int table_start=14+biSize;
+    uint8_t color_val=0;
+
+    for(uint8_t i=0; i<2; ++i) {
+        if(!((data[table_start+i*4]<<16)|(data[table_start+i*4+1]<<8)|data[table_start+i*4+2])) {
+            color_val=i;
+            break;
+        }
+    }
+
+    uint32_t bytes_per_line=(biWidth/8)+(biWidth&7?1:0);
+    if(bytes_per_line&3)
+        bytes_per_line=(bytes_per_line^(bytes_per_line&3))+4;
+
+    const uint8_t *img_data=data+bfOffBits;
+
+    int32_t step=biHeight>0?-1:1;
+    int32_t border=biHeight>0?-1:-biHeight;
+
+    for(uint32_t y=biHeight>0?biHeight-1:0; y!=(uint32_t)border; y+=step) {
+        for(uint32_t x=0; x<biWidth; ++x) {
+            if(((img_data[x>>3]>>(7-(x&7)))&1)==color_val)
+                ssd1306_draw_pixel(p, x_offset+x, y_offset+y);
+        }
+        img_data+=bytes_per_line;
+    }
+}
+
+inline void ssd1306_bmp_show_image(ssd1306_t *p, const uint8_t *data, const long size) {
+    ssd1306_bmp_show_image_with_offset(p, data, size, 0, 0);
+}
+
+// writes n image bytes (src, or value when src is NULL) at image column col of image page page
+static void ssd1306_image_put(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t col, uint32_t page, const uint8_t *src, uint8_t value, uint32_t n) {
+    const uint32_t row=y+(page<<3);
+    const uint32_t dst_page=row>>3;
+    const uint32_t shift=row&7;
+
+    x+=col;
+    if(x>=p->width || dst_page>=p->pages)
+        return;
+    if(n>p->width-x)
+        n=p->width-x;
+
+    uint8_t *dst=p->buffer+dst_page*p->width+x;
+    if(!shift) {
+        if(src)
+            memcpy(dst, src, n);
+        else
+            memset(dst, value, n);
+        return;
+    }
+
+    // rows above the image stay in the top page, rows below it in the next one
+    const uint8_t keep_top=0xff>>(8-shift);
+    const uint8_t keep_below=0xff<<shift;
+    uint8_t *below=dst_page+1<p->pages?dst+p->width:NULL;
+    for(uint32_t i=0; i<n; ++i) {
+        const uint8_t b=src?src[i]:value;
+        dst[i]=(dst[i]&keep_top)|(b<<shift);
+        if(below)
+            below[i]=(below[i]&keep_below)|(b>>(8-shift));
+    }
+}
+
+void ssd1306_draw_image(ssd1306_t *p, uint32_t x, uint32_t y, const ssd1306_image_t *img) {
+    if(x>=p->width || y>=p->height || !img->width || !img->pages)
+        return;
+
+    const uint8_t *d=img->data;
+    const uint8_t *const end=d+img->size;
+
+    if(img->format==SSD1306_IMAGE_RAW) {
+        for(uint32_t page=0; page<img->pages && d+img->width<=end; ++page, d+=img->width)
+            ssd1306_image_put(p, x, y, 0, page, d, 0, img->width);
+    } else {
+        // page aligned and fully visible: runs go straight into the buffer rows
+        const bool direct=!(y&7) && x+img->width<=p->width && (y>>3)+img->pages<=p->pages;
+        uint8_t *row=p->buffer+(y>>3)*p->width+x;
+        uint32_t col=0, page=0;
+        while(d<end && page<img->pages) {
+            const uint8_t c=*d++;
+            const bool literal=c<0x80;
+            uint32_t n=literal?c+1u:c-0x7eu;
+            if(literal?(size_t)(end-d)<n:d==end)
+                break;
+
+            const uint8_t *src=literal?d:NULL;
+            const uint8_t value=literal?0:*d;
+            d+=literal?n:1;
+
+            // a run may wrap to the next page row of the image
+            while(n && page<img->pages) {
+                const uint32_t chunk=n<img->width-col?n:img->width-col;
+                if(!direct)
+                    ssd1306_image_put(p, x, y, col, page, src, value, chunk);
+                else if(src)
+                    for(uint32_t i=0; i<chunk; ++i) row[col+i]=src[i];
+                else
+                    memset(row+col, value, chunk);
+                if(src)
+                    src+=chunk;
+                n-=chunk;
+                col+=chunk;
+                if(col==img->width) {
+                    col=0;
+                    ++page;
+                    row+=p->width;
+                }
+            }
+        }
+    }
+
+    const uint32_t x1=x+img->width-1u<p->width?x+img->width-1u:p->width-1u;
+    uint32_t last_page=(y+(img->pages<<3)-1)>>3;
+    if(last_page>=p->pages)
+        last_page=p->pages-1;
+    ssd1306_mark_ink(p, x, x1, y>>3, last_page);
+}
+
+// sends len bytes starting at src as display data; the byte before src is borrowed for the 0x40 control byte
+static void ssd1306_write_data(ssd1306_t *p, uint8_t *src, size_t len) {
+    ssd1306_wait_bus(p);
+
+    uint8_t saved=*(src-1);
+    *(src-1)=0x40;
+
+    fancy_write(p, src-1, len+1, "ssd1306_show");
+
+    *(src-1)=saved;
+}
+
+static void ssd1306_set_window(ssd1306_t *p, uint8_t x0, uint8_t x1, uint8_t p0, uint8_t p1) {
+    uint8_t payload[]= {SET_COL_ADDR, x0, x1, SET_PAGE_ADDR, p0, p1};
+    if(p->width==64) {
+        payload[1]+=32;
+        payload[2]+=32;
+    }
+
+    ssd1306_write_cmds(p, payload, sizeof(payload));
+}
+
+// word of a 4 byte aligned buffer (buffer and shadow are), loaded without breaking strict aliasing
+static inline uint32_t ssd1306_load_word(const uint8_t *s) {
+    uint32_t w;
+    memcpy(&w, __builtin_assume_aligned(s, 4), sizeof(w));
+    return w;
+}
+
+// columns of page in [x0..x1] that differ from the shadow, compared 32 bits at a time
+static bool ssd1306_diff_page(const ssd1306_t *p, uint8_t page, uint8_t x0, uint8_t x1, uint8_t *c0, uint8_t *c1) {
+    const size_t row=page*p->width;
+    const uint8_t *cur=p->buffer+row;
+    const uint8_t *old=p->shadow+row;
+
+    if(p->width&3) {
+        while(x0<=x1 && cur[x0]==old[x0]) ++x0;
+        if(x0>x1)
+            return false;
+        while(cur[x1]==old[x1]) --x1;
+    } else {
+        uint32_t w0=x0>>2, w1=x1>>2;
+
+        while(w0<=w1 && ssd1306_load_word(cur+4*w0)==ssd1306_load_word(old+4*w0)) ++w0;
+        if(w0>w1)
+            return false;
+        while(ssd1306_load_word(cur+4*w1)==ssd1306_load_word(old+4*w1)) --w1;
+
+        x0=w0<<2;
+        while(cur[x0]==old[x0]) ++x0;
+        x1=(w1<<2)|3;
+        while(cur[x1]==old[x1]) --x1;
+    }
+
+    *c0=x0;
+    *c1=x1;
+    return true;
+}
+
+// shrinks the dirty window to the bounding box of the bytes that differ from the shadow
+static bool ssd1306_diff_window(const ssd1306_t *p, const ssd1306_window_t *dirty, ssd1306_window_t *win) {
+    ssd1306_window_t w=SSD1306_WINDOW_EMPTY;
+    uint8_t c0, c1;
+
+    for(uint8_t page=dirty->p0; page<=dirty->p1; ++page)
+        if(ssd1306_diff_page(p, page, dirty->x0, dirty->x1, &c0, &c1))
+            ssd1306_window_add(&w, c0, c1, page, page);
+
+    *win=w;
+    return !ssd1306_window_is_empty(&w);
+}
+
+static void ssd1306_shadow_update(ssd1306_t *p, const ssd1306_window_t *w) {
+    if(p->shadow==NULL)
+        return;
+
+    const size_t cols=w->x1-w->x0+1;
+    for(uint8_t page=w->p0; page<=w->p1; ++page) {
+        const size_t offset=page*p->width+w->x0;
+        memcpy(p->shadow+offset, p->buffer+offset, cols);
+    }
+}
+
+// takes the pending window, narrowed to what differs from the shadow unless the display must be resent
+static bool ssd1306_take_window(ssd1306_t *p, ssd1306_window_t *win) {
+    const ssd1306_window_t dirty=p->dirty;
+    if(ssd1306_window_is_empty(&dirty))
+        return false;
+
+    p->dirty=SSD1306_WINDOW_EMPTY;
+
+    if(p->shadow!=NULL && !p->resend)
+        return ssd1306_diff_window(p, &dirty, win);
+
+    p->resend=false;
+    *win=dirty;
+    return true;
+}
+
+bool ssd1306_show_begin(ssd1306_t *p, ssd1306_window_t *win) {
+    ssd1306_window_t w;
+    // the controller forbids RAM writes during a hardware scroll, drawing stays dirty until ssd1306_scroll_stop
+    if(p->scrolling || !ssd1306_take_window(p, &w))
+        return false;
+
+    ssd1306_set_window(p, w.x0, w.x1, w.p0, w.p1);
+    ssd1306_shadow_update(p, &w);
+
+    *win=w;
+    return true;
+}
+
+void ssd1306_show(ssd1306_t *p) {
+    if(p->scrolling)
+        return;
+
+    // with a shadow every changed page is sent as its own column run
+    if(p->shadow!=NULL && !p->resend) {
+        const ssd1306_window_t dirty=p->dirty;
+        if(ssd1306_window_is_empty(&dirty))
+            return;
+
+        p->dirty=SSD1306_WINDOW_EMPTY;
+
+        uint8_t c0, c1;
+        for(uint8_t page=dirty.p0; page<=dirty.p1; ++page) {
+            if(!ssd1306_diff_page(p, page, dirty.x0, dirty.x1, &c0, &c1))
+                continue;
+
+            const ssd1306_window_t run= {c0, c1, page, page};
+            ssd1306_set_window(p, c0, c1, page, page);
+            ssd1306_shadow_update(p, &run);
+            ssd1306_write_data(p, p->buffer+page*p->width+c0, c1-c0+1);
+        }
+        return;
+    }
+
+    ssd1306_window_t w;
+    if(!ssd1306_show_begin(p, &w))
+        return;
+
+    const size_t cols=w.x1-w.x0+1;
+    uint8_t *start=p->buffer+w.p0*p->width+w.x0;
+
+    // full-width window is contiguous in the buffer
+    if(cols==p->width) {
+        ssd1306_write_data(p, start, (w.p1-w.p0+1)*cols);
+        return;
+    }
+
+    // otherwise one transfer per page, the column window makes the display wrap to the next page
+    for(uint8_t page=w.p0; page<=w.p1; ++page, start+=p->width)
+        ssd1306_write_data(p, start, cols);
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+/*
+ * LRU cache of rendered strings for ssd1306.
+ *
+ * A miss renders the string once into the entry through a scratch ssd1306_t
+ * whose buffer is the entry bitmap, so cached and direct drawing share the
+ * same glyph code and give the same pixels. A hit is one ssd1306_draw_pages.
+ */
+
+#include <string.h>
+
+#include "ssd1306_text_cache.h"
+
+typedef enum {
+    SSD1306_TEXT_FONT,
+    SSD1306_TEXT_ATLAS
+} ssd1306_text_kind_t;
+
+void ssd1306_text_cache_init(ssd1306_text_cache_t *cache) {
+    memset(cache, 0, sizeof(*cache));
+}
+
+static ssd1306_text_entry_t *ssd1306_text_cache_find(ssd1306_text_cache_t *cache, const void *font, uint32_t scale, const char *s, size_t len) {
+    for(size_t i=0; i<SSD1306_TEXT_CACHE_ENTRIES; ++i) {
+        ssd1306_text_entry_t *e=cache->entries+i;
+        if(e->font==font && e->scale==scale && e->len==len && memcmp(e->text, s, len)==0)
+            return e;
+    }
+    return NULL;
+}
+
+static ssd1306_text_entry_t *ssd1306_text_cache_victim(ssd1306_text_cache_t *cache) {
+    ssd1306_text_entry_t *victim=cache->entries;
+    for(size_t i=0; i<SSD1306_TEXT_CACHE_ENTRIES; ++i) {
+        ssd1306_text_entry_t *e=cache->entries+i;
+        if(e->font==NULL)
+            return e;
+        if(e->used<victim->used)
+            victim=e;
+    }
+    return victim;
+}
+
+static void ssd1306_text_render(ssd1306_text_entry_t *e, ssd1306_text_kind_t kind, const char *s) {
+    // scratch display the size of the bitmap, drawing functions only touch buffer and windows
+    ssd1306_t scratch= {
+        .width=e->cols,
+        .height=e->pages*8,
+        .pages=e->pages,
+        .buffer=e->bitmap,
+        .bufsize=(size_t) e->cols*e->pages,
+    };
+
+    memset(e->bitmap, 0, scratch.bufsize);
+    if(kind==SSD1306_TEXT_ATLAS)
+        ssd1306_draw_string_with_atlas(&scratch, 0, 0, e->scale, e->font, s);
+    else
+        ssd1306_draw_string_with_font(&scratch, 0, 0, e->scale, e->font, s);
+}
+
+static uint32_t ssd1306_text_draw(ssd1306_t *p, ssd1306_text_cache_t *cache, uint32_t x, uint32_t y, uint32_t scale,
+                                  const void *font, ssd1306_text_kind_t kind, const char *s) {
+    const size_t len=strlen(s);
+    uint32_t cols, advance=0, height;
+
+    if(kind==SSD1306_TEXT_ATLAS) {
+        const ssd1306_atlas_t *atlas=font;
+        cols=ssd1306_string_width_with_atlas(atlas, scale, s);
+        height=atlas->height*scale;
+    } else {
+        const uint8_t *f=font;
+        advance=len*(f[1]+f[2])*scale;
+        cols=len?advance-f[2]*scale:0;
+        height=f[0]*scale;
+    }
+
+    const uint32_t pages=(height+7)>>3;
+    ++cache->clock;
+
+    ssd1306_text_entry_t *e=ssd1306_text_cache_find(cache, font, scale, s, len);
+    if(e!=NULL) {
+        ++cache->hits;
+    } else {
+        ++cache->misses;
+        // does not fit an entry: draw it the usual way
+        if(!len || len>SSD1306_TEXT_CACHE_KEY || cols>255 || pages>255 || cols*pages>SSD1306_TEXT_CACHE_BITMAP) {
+            if(kind==SSD1306_TEXT_ATLAS)
+                return ssd1306_draw_string_with_atlas(p, x, y, scale, font, s);
+            ssd1306_draw_string_with_font(p, x, y, scale, font, s);
+            return x+advance;
+        }
+
+        e=ssd1306_text_cache_victim(cache);
+        e->font=font;
+        e->scale=scale;
+        e->len=len;
+        e->cols=cols;
+        e->pages=pages;
+        memcpy(e->text, s, len);
+        if(kind==SSD1306_TEXT_ATLAS) {
+            // pen after the last glyph (spacing and kerning included): on a 0x0 display drawing only moves the pen
+            ssd1306_t none= {.width=0, .height=0};
+            advance=ssd1306_draw_string_with_atlas(&none, 0, 0, scale, font, s);
+        }
+        e->advance=advance;
+        ssd1306_text_render(e, kind, s);
+    }
+
+    e->used=cache->clock;
+    ssd1306_draw_pages(p, x, y, e->bitmap, e->cols, e->pages);
+    return x+e->advance;
+}
+
+uint32_t ssd1306_draw_cached_string_with_font(ssd1306_t *p, ssd1306_text_cache_t *cache, uint32_t x, uint32_t y, uint32_t scale, const uint8_t *font, const char *s) {
+    return ssd1306_text_draw(p, cache, x, y, scale, font, SSD1306_TEXT_FONT, s);
+}
+
+uint32_t ssd1306_draw_cached_string_with_atlas(ssd1306_t *p, ssd1306_text_cache_t *cache, uint32_t x, uint32_t y, uint32_t scale, const ssd1306_atlas_t *atlas, const char *s) {
+    return ssd1306_text_draw(p, cache, x, y, scale, atlas, SSD1306_TEXT_ATLAS, s);
+}
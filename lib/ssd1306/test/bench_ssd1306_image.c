@@ -0,0 +1,117 @@
+/*
+ * Microbenchmark host do desenho de imagens: BMP de 1 bit plotado pixel a
+ * pixel (ssd1306_bmp_show_image) contra ssd1306_draw_image com a mesma
+ * imagem crua e em RLE, para as telas do galton_board e do checkin.
+ * Mostra tambem quanto cada formato ocupa na flash.
+ *
+ * Compilar e rodar (a partir de lib/ssd1306):
+ *   gcc -std=c11 -O2 -DSSD1306_HOST -Iinclude test/bench_ssd1306_image.c src/ssd1306_i2c.c src/ssd1306_host.c -o bench_image && ./bench_image
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <time.h>
+#include "ssd1306.h"
+#include "ssd1306_host.h"
+#include "frames.h"
+#include "../tools/ssd1306_image_encode.h"
+
+#define ITERATIONS 20000
+#define BMP_HEADER 62
+#define BMP_STRIDE ((FRAME_W + 31) / 32 * 4)
+
+static ssd1306_host_t host;
+static ssd1306_t disp;
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void put_le(uint8_t *p, uint32_t v, int n) {
+    for (int i = 0; i < n; i++, v >>= 8)
+        p[i] = (uint8_t)v;
+}
+
+/* BMP de 1 bit, de baixo para cima, paleta {preto, branco}: preto acende o pixel */
+static size_t make_bmp(const uint8_t *frame, uint8_t *bmp) {
+    const size_t size = BMP_HEADER + BMP_STRIDE * FRAME_H;
+    memset(bmp, 0, size);
+    bmp[0] = 'B';
+    bmp[1] = 'M';
+    put_le(bmp + 2, size, 4);
+    put_le(bmp + 10, BMP_HEADER, 4);
+    put_le(bmp + 14, 40, 4);
+    put_le(bmp + 18, FRAME_W, 4);
+    put_le(bmp + 22, FRAME_H, 4);
+    put_le(bmp + 26, 1, 2);
+    put_le(bmp + 28, 1, 2);
+    put_le(bmp + 58, 0xffffff, 3);
+    for (uint32_t y = 0; y < FRAME_H; y++) {
+        uint8_t *row = bmp + BMP_HEADER + BMP_STRIDE * (FRAME_H - 1 - y);
+        for (uint32_t x = 0; x < FRAME_W; x++)
+            if (!((frame[(y >> 3) * FRAME_W + x] >> (y & 7)) & 1))
+                row[x >> 3] |= 0x80 >> (x & 7);
+    }
+    return size;
+}
+
+static void bench(const char *name) {
+    static uint8_t frame[FRAME_W * FRAME_H / 8], rle[SSD1306_IMAGE_RLE_MAX(sizeof frame)];
+    static uint8_t bmp[BMP_HEADER + BMP_STRIDE * FRAME_H];
+    volatile uint8_t sink = 0;
+
+    memcpy(frame, disp.buffer, sizeof frame);
+    const size_t bmp_len = make_bmp(frame, bmp);
+    const size_t rle_len = ssd1306_image_rle(frame, sizeof frame, rle);
+    const ssd1306_image_t raw_img = {FRAME_W, FRAME_H / 8, SSD1306_IMAGE_RAW, sizeof frame, frame};
+    const ssd1306_image_t rle_img = {FRAME_W, FRAME_H / 8, SSD1306_IMAGE_RLE, (uint16_t)rle_len, rle};
+
+    double t0 = now_ns();
+    for (int n = 0; n < ITERATIONS; n++) {
+        ssd1306_clear(&disp);
+        ssd1306_bmp_show_image(&disp, bmp, bmp_len);
+        sink ^= disp.buffer[n & 1023];
+    }
+    const double t_bmp = (now_ns() - t0) / ITERATIONS;
+    if (memcmp(frame, disp.buffer, sizeof frame) != 0)
+        printf("%s: BMP diferente do quadro\n", name);
+
+    const ssd1306_image_t *imgs[] = {&raw_img, &rle_img};
+    double t_img[2];
+    for (int k = 0; k < 2; k++) {
+        t0 = now_ns();
+        for (int n = 0; n < ITERATIONS; n++) {
+            ssd1306_draw_image(&disp, 0, 0, imgs[k]);
+            sink ^= disp.buffer[n & 1023];
+        }
+        t_img[k] = (now_ns() - t0) / ITERATIONS;
+        if (memcmp(frame, disp.buffer, sizeof frame) != 0)
+            printf("%s: imagem diferente do quadro\n", name);
+    }
+
+    printf("%-18s %6zu %9.0f | %5zu %8.0f | %5zu %8.0f\n", name, bmp_len, t_bmp,
+           sizeof frame, t_img[0], rle_len, t_img[1]);
+    (void)sink;
+}
+
+int main(void) {
+    galton_state_t g = {0};
+
+    ssd1306_host_reset(&host);
+    ssd1306_init_backend(&disp, FRAME_W, FRAME_H, 0x3c, &ssd1306_host_backend, &host);
+
+    printf("%-18s %6s %9s | %5s %8s | %5s %8s\n", "tela", "BMP B", "BMP ns", "crua", "ns", "RLE", "ns");
+    srand(1);
+    for (int i = 0; i < 400; i++)
+        galton_step(&g);
+    draw_galton_balls(&disp, &g);
+    bench("galton_bolas");
+    draw_galton_hist(&disp, &g);
+    bench("galton_histograma");
+    draw_checkin(&disp, 3, 47);
+    bench("checkin_andar3");
+
+    ssd1306_deinit(&disp);
+    return 0;
+}
@@ -0,0 +1,80 @@
+/*
+ * Benchmark host do ssd1306_show: bytes e microssegundos por quadro, com e sem
+ * a copia do ultimo quadro (ssd1306_shadow_init).
+ *
+ * "cpu" e' o tempo de ssd1306_show medido no PC; "bus" e' o tempo estimado no
+ * I2C a 400 kHz (9 bits por byte, mais endereco e start/stop por transferencia).
+ *
+ * Compilar e rodar (a partir de lib/ssd1306):
+ *   gcc -std=c11 -O2 -DSSD1306_HOST -Iinclude test/bench_ssd1306_show.c src/ssd1306_i2c.c -o bench_show && ./bench_show
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <time.h>
+#include "ssd1306.h"
+#include "frames.h"
+
+#define I2C_HZ   400000.0
+#define FRAMES   500
+
+static size_t bus_bytes, bus_transfers;
+
+/* backend que so' conta, para o tempo de cpu nao incluir o emulador */
+static int count_write(void *ctx, uint8_t addr, const uint8_t *src, size_t len) {
+    (void)ctx; (void)addr; (void)src;
+    bus_bytes += len;
+    bus_transfers++;
+    return (int)len;
+}
+
+static const ssd1306_backend_t count_backend = { .write = count_write };
+
+static double now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+typedef enum { SCREEN_BALLS, SCREEN_HIST, SCREEN_CHECKIN } screen_t;
+
+static void run(const char *name, screen_t screen, bool shadow) {
+    ssd1306_t d = {0};
+    galton_state_t g = {0};
+    double cpu = 0;
+
+    srand(1);
+    ssd1306_init_backend(&d, 128, 64, 0x3c, &count_backend, NULL);
+    if (shadow)
+        ssd1306_shadow_init(&d);
+    ssd1306_clear(&d);
+    ssd1306_show(&d);
+    bus_bytes = bus_transfers = 0;
+
+    for (int i = 0; i < FRAMES; i++) {
+        switch (screen) {
+        case SCREEN_BALLS:   galton_step(&g); draw_galton_balls(&d, &g); break;
+        case SCREEN_HIST:    galton_step(&g); draw_galton_hist(&d, &g); break;
+        case SCREEN_CHECKIN: draw_checkin(&d, (i / 10) % 5, i % 50); break;
+        }
+        double t0 = now_us();
+        ssd1306_show(&d);
+        cpu += now_us() - t0;
+    }
+
+    double bus_us = (bus_bytes + 2.0 * bus_transfers) * 9.0 / I2C_HZ * 1e6;
+    printf("%-18s %-7s %7.1f bytes %6.1f transf. %8.2f us cpu %8.1f us bus\n", name,
+           shadow ? "shadow" : "window", (double)bus_bytes / FRAMES, (double)bus_transfers / FRAMES,
+           cpu / FRAMES, bus_us / FRAMES);
+    ssd1306_deinit(&d);
+}
+
+int main(void) {
+    printf("por quadro (%d quadros, cheio = 1032 bytes)\n", FRAMES);
+    run("galton bolas", SCREEN_BALLS, false);
+    run("galton bolas", SCREEN_BALLS, true);
+    run("galton histograma", SCREEN_HIST, false);
+    run("galton histograma", SCREEN_HIST, true);
+    run("checkin", SCREEN_CHECKIN, false);
+    run("checkin", SCREEN_CHECKIN, true);
+    return 0;
+}
@@ -0,0 +1,91 @@
+/*
+ * Microbenchmark host do desenho de texto: tempo por string no caminho
+ * rapido (escala 1, coluna de byte) contra o caminho original pixel a pixel,
+ * para as strings que checkin.c e galton_board.c desenham. A segunda tabela
+ * compara o atlas (ssd1306_font_atlas.h) com ssd1306_draw_string nas escalas
+ * 1 e 2, e os digitos grandes com a fonte 8x5 em escala 2.
+ *
+ * Compilar e rodar (a partir de lib/ssd1306):
+ *   gcc -std=c11 -O2 -DSSD1306_HOST -Iinclude test/bench_ssd1306_text.c src/ssd1306_i2c.c src/ssd1306_host.c -o bench_text && ./bench_text
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <time.h>
+#include "ssd1306.h"
+#include "ssd1306_host.h"
+#include "ssd1306_font.h"
+#include "ssd1306_font_atlas.h"
+#include "frames.h"
+#include "reference.h"
+
+#define ITERATIONS 200000
+
+static ssd1306_host_t host;
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static const struct { const char *s; uint32_t y; } strings[] = {
+    {"Terreo: 12 pessoas", 0},      /* checkin.c update_oled_display */
+    {"Andar 3: 47 pessoas", 0},
+    {"Iniciando sistema!", 0},      /* checkin.c mostrar_mensagem */
+    {"1234", 0},                    /* galton_board.c contador */
+    {"Andar 3: 47 pessoas", 13},    /* y fora do alinhamento de pagina */
+};
+
+int main(void) {
+    static ssd1306_t disp;
+    static uint8_t ref_buf[FRAME_W * FRAME_H / 8];
+    volatile uint8_t sink = 0;
+
+    ssd1306_host_reset(&host);
+
+    ssd1306_init_backend(&disp, FRAME_W, FRAME_H, 0x3c, &ssd1306_host_backend, &host);
+    printf("%-22s %4s %12s %12s %8s\n", "string", "y", "original ns", "rapido ns", "ganho");
+
+    for (size_t i = 0; i < sizeof strings / sizeof strings[0]; i++) {
+        double t0 = now_ns();
+        for (int n = 0; n < ITERATIONS; n++) {
+            ref_draw_string(ref_buf, 0, strings[i].y, 1, font_8x5, strings[i].s);
+            sink ^= ref_buf[n & 127];
+        }
+        double t_ref = (now_ns() - t0) / ITERATIONS;
+
+        t0 = now_ns();
+        for (int n = 0; n < ITERATIONS; n++) {
+            ssd1306_draw_string(&disp, 0, strings[i].y, 1, strings[i].s);
+            sink ^= disp.buffer[n & 127];
+        }
+        double t_fast = (now_ns() - t0) / ITERATIONS;
+
+        printf("%-22s %4u %12.1f %12.1f %7.1fx\n", strings[i].s, strings[i].y, t_ref, t_fast, t_ref / t_fast);
+    }
+
+    printf("\n%-22s %6s %12s %12s %8s\n", "string", "escala", "fonte ns", "atlas ns", "ganho");
+    for (uint32_t scale = 1; scale <= 2; scale++) {
+        for (size_t i = 0; i < sizeof strings / sizeof strings[0]; i++) {
+            double t0 = now_ns();
+            for (int n = 0; n < ITERATIONS; n++) {
+                ssd1306_draw_string(&disp, 0, strings[i].y, scale, strings[i].s);
+                sink ^= disp.buffer[n & 127];
+            }
+            double t_font = (now_ns() - t0) / ITERATIONS;
+
+            const ssd1306_atlas_t *atlas = scale == 2 && strings[i].s[0] == '1' ? &atlas_digits_16 : &atlas_8x5;
+            t0 = now_ns();
+            for (int n = 0; n < ITERATIONS; n++) {
+                ssd1306_draw_string_with_atlas(&disp, 0, strings[i].y, atlas == &atlas_digits_16 ? 1 : scale, atlas, strings[i].s);
+                sink ^= disp.buffer[n & 127];
+            }
+            double t_atlas = (now_ns() - t0) / ITERATIONS;
+            printf("%-22s %6u %12.1f %12.1f %7.1fx%s\n", strings[i].s, scale, t_font, t_atlas, t_font / t_atlas,
+                   atlas == &atlas_digits_16 ? "  (digitos grandes)" : "");
+        }
+    }
+
+    ssd1306_deinit(&disp);
+    return sink == 0xff;
+}
@@ -0,0 +1,92 @@
+/*
+ * Microbenchmark host da latencia de atualizacao das telas com texto fixo:
+ * snprintf + desenho da linha inteira (como checkin.c e Contadorr.c faziam)
+ * contra rotulos vindos do cache (ssd1306_text_cache.h) e so o numero
+ * desenhado na hora. Inclui o ssd1306_clear; o envio ao display nao entra.
+ *
+ * Compilar e rodar (a partir de lib/ssd1306):
+ *   gcc -std=c11 -O2 -DSSD1306_HOST -Iinclude test/bench_ssd1306_text_cache.c src/ssd1306_i2c.c src/ssd1306_text_cache.c src/ssd1306_host.c -o bench_text_cache && ./bench_text_cache
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <time.h>
+#include "ssd1306.h"
+#include "ssd1306_host.h"
+#include "ssd1306_font.h"
+#include "ssd1306_font_atlas.h"
+#include "ssd1306_text_cache.h"
+#include "frames.h"
+
+#define ITERATIONS 200000
+
+static ssd1306_host_t host;
+static ssd1306_t disp;
+static ssd1306_text_cache_t cache;
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* Contadorr.c: duas linhas "Contador: %d" e "Botao B: %d" */
+static void contador_direct(int n) {
+    char l1[32], l2[32];
+    snprintf(l1, sizeof l1, "Contador: %d", n % 10);
+    snprintf(l2, sizeof l2, "Botao B: %d", n % 100);
+    ssd1306_clear(&disp);
+    ssd1306_draw_string(&disp, 0, 0, 1, l1);
+    ssd1306_draw_string(&disp, 0, 16, 1, l2);
+}
+
+static void contador_cached(int n) {
+    char num[12];
+    ssd1306_clear(&disp);
+    uint32_t x = ssd1306_draw_cached_string_with_font(&disp, &cache, 0, 0, 1, font_8x5, "Contador: ");
+    snprintf(num, sizeof num, "%d", n % 10);
+    ssd1306_draw_string(&disp, x, 0, 1, num);
+    x = ssd1306_draw_cached_string_with_font(&disp, &cache, 0, 16, 1, font_8x5, "Botao B: ");
+    snprintf(num, sizeof num, "%d", n % 100);
+    ssd1306_draw_string(&disp, x, 16, 1, num);
+}
+
+/* checkin.c: "Andar %d: %d pessoas" na fonte proporcional */
+static void checkin_direct(int n) {
+    char buf[64];
+    ssd1306_clear(&disp);
+    snprintf(buf, sizeof buf, "Andar %d: %d pessoas", 1 + n % 4, n % 50);
+    ssd1306_draw_string_with_atlas(&disp, 0, 0, 1, &atlas_8x5, buf);
+}
+
+static void checkin_cached(int n) {
+    static const char *const floors[] = {"Andar 1: ", "Andar 2: ", "Andar 3: ", "Andar 4: "};
+    char num[12];
+    ssd1306_clear(&disp);
+    uint32_t x = ssd1306_draw_cached_string_with_atlas(&disp, &cache, 0, 0, 1, &atlas_8x5, floors[n % 4]);
+    snprintf(num, sizeof num, "%d", n % 50);
+    x = ssd1306_draw_string_with_atlas(&disp, x, 0, 1, &atlas_8x5, num);
+    ssd1306_draw_cached_string_with_atlas(&disp, &cache, x, 0, 1, &atlas_8x5, " pessoas");
+}
+
+static double bench(void (*update)(int)) {
+    double t0 = now_ns();
+    for (int n = 0; n < ITERATIONS; n++)
+        update(n);
+    return (now_ns() - t0) / ITERATIONS;
+}
+
+int main(void) {
+    ssd1306_host_reset(&host);
+    ssd1306_init_backend(&disp, FRAME_W, FRAME_H, 0x3c, &ssd1306_host_backend, &host);
+    ssd1306_text_cache_init(&cache);
+
+    printf("%-10s %12s %12s %8s\n", "tela", "direto ns", "cache ns", "ganho");
+    const double c_direct = bench(contador_direct), c_cached = bench(contador_cached);
+    printf("%-10s %12.1f %12.1f %7.1fx\n", "Contadorr", c_direct, c_cached, c_direct / c_cached);
+    const double k_direct = bench(checkin_direct), k_cached = bench(checkin_cached);
+    printf("%-10s %12.1f %12.1f %7.1fx\n", "checkin", k_direct, k_cached, k_direct / k_cached);
+    printf("cache: %u acertos, %u renderizacoes\n", (unsigned) cache.hits, (unsigned) cache.misses);
+
+    ssd1306_deinit(&disp);
+    return 0;
+}
@@ -0,0 +1,94 @@
+/*
+ * Quadros tipicos das aplicacoes (galton_board.c e checkin.c) reproduzidos
+ * para os testes host do driver ssd1306.
+ */
+#ifndef _test_frames_h
+#define _test_frames_h
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "ssd1306.h"
+
+#define FRAME_W 128
+#define FRAME_H  64
+
+/* mesmos parametros de galton_board.c */
+#define G_NUM_BINS      16
+#define G_BIN_W        (FRAME_W / G_NUM_BINS)
+#define G_PIN_SPACING_Y  4
+#define G_DX             4
+#define G_MAX_BALLS      8
+#define G_PIN_ROWS     ((FRAME_H - 10) / G_PIN_SPACING_Y)
+#define G_BOARD_HALF   (G_PIN_ROWS * G_DX)
+
+typedef struct { int x, y; bool alive; } frame_ball_t;
+
+typedef struct {
+    frame_ball_t balls[G_MAX_BALLS];
+    uint16_t hist[G_NUM_BINS];
+    uint32_t total;
+    uint32_t tick;
+} galton_state_t;
+
+static inline void galton_step(galton_state_t *g) {
+    const int cx = FRAME_W / 2;
+    if (g->tick % 10 == 0) {
+        for (int i = 0; i < G_MAX_BALLS; i++)
+            if (!g->balls[i].alive) { g->balls[i] = (frame_ball_t){cx, 0, true}; break; }
+    }
+    for (int i = 0; i < G_MAX_BALLS; i++) {
+        frame_ball_t *b = &g->balls[i];
+        if (!b->alive) continue;
+        if (b->y % G_PIN_SPACING_Y == 0) {
+            b->x += (rand() & 1) ? G_DX : -G_DX;
+            if (b->x < cx - G_BOARD_HALF) b->x = cx - G_BOARD_HALF;
+            if (b->x > cx + G_BOARD_HALF) b->x = cx + G_BOARD_HALF;
+        }
+        if (++b->y >= FRAME_H - 1) {
+            g->hist[b->x / G_BIN_W]++; g->total++;
+            *b = (frame_ball_t){cx, 0, true};
+        }
+    }
+    g->tick++;
+}
+
+/* Tela 1: pinos + bolas + contador */
+static inline void draw_galton_balls(ssd1306_t *d, const galton_state_t *g) {
+    char buf[16];
+    ssd1306_clear(d);
+    for (int row = 1; row <= G_PIN_ROWS; row++)
+        for (int col = -row; col <= row; col += 2)
+            ssd1306_draw_pixel(d, FRAME_W / 2 + col * G_DX, row * G_PIN_SPACING_Y);
+    for (int i = 0; i < G_MAX_BALLS; i++)
+        if (g->balls[i].alive)
+            ssd1306_draw_pixel(d, g->balls[i].x, g->balls[i].y);
+    snprintf(buf, sizeof buf, "%lu", (unsigned long)g->total);
+    ssd1306_draw_string(d, 0, 0, 1, buf);
+}
+
+/* Tela 2: histograma + contador */
+static inline void draw_galton_hist(ssd1306_t *d, const galton_state_t *g) {
+    char buf[16];
+    ssd1306_clear(d);
+    for (int b = 0; b < G_NUM_BINS; b++) {
+        int h = (g->hist[b] * (FRAME_H - 8)) / 50;
+        if (h > FRAME_H - 8) h = FRAME_H - 8;
+        if (h > 0)
+            ssd1306_draw_square(d, b * G_BIN_W, FRAME_H - h, G_BIN_W - 1, h);
+    }
+    snprintf(buf, sizeof buf, "%lu", (unsigned long)g->total);
+    ssd1306_draw_string(d, 0, 0, 1, buf);
+}
+
+/* update_oled_display() do checkin.c */
+static inline void draw_checkin(ssd1306_t *d, int floor, int count) {
+    char buf[64];
+    ssd1306_clear(d);
+    if (floor == 0)
+        snprintf(buf, sizeof buf, "Terreo: %d pessoas", count);
+    else
+        snprintf(buf, sizeof buf, "Andar %d: %d pessoas", floor, count);
+    ssd1306_draw_string(d, 0, 0, 1, buf);
+}
+
+#endif
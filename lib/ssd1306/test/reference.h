@@ -0,0 +1,96 @@
+/*
+ * Versoes originais (pixel a pixel) das rotinas de desenho do ssd1306_i2c.c,
+ * usadas pelos testes host como referencia de resultado e pelos benchmarks
+ * como linha de base.
+ */
+#ifndef _test_reference_h
+#define _test_reference_h
+
+#include <string.h>
+#include "ssd1306.h"
+#include "frames.h"
+
+static inline void ref_draw_pixel(uint8_t *buf, uint32_t x, uint32_t y) {
+    if (x >= FRAME_W || y >= FRAME_H) return;
+    buf[x + FRAME_W * (y >> 3)] |= 0x1 << (y & 0x07);
+}
+
+static inline void ref_draw_square(uint8_t *buf, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+    for (uint32_t i = 0; i < width; ++i)
+        for (uint32_t j = 0; j < height; ++j)
+            ref_draw_pixel(buf, x + i, y + j);
+}
+
+static inline void ref_draw_char(uint8_t *buf, uint32_t x, uint32_t y, uint32_t scale, const uint8_t *font, char c) {
+    if (c < font[3] || c > font[4])
+        return;
+
+    uint32_t parts_per_line = (font[0] >> 3) + ((font[0] & 7) > 0);
+    for (uint8_t w = 0; w < font[1]; ++w) {
+        uint32_t pp = (c - font[3]) * font[1] * parts_per_line + w * parts_per_line + 5;
+        for (uint32_t lp = 0; lp < parts_per_line; ++lp) {
+            uint8_t line = font[pp];
+            for (int8_t j = 0; j < 8; ++j, line >>= 1)
+                if (line & 1)
+                    ref_draw_square(buf, x + w * scale, y + ((lp << 3) + j) * scale, scale, scale);
+            ++pp;
+        }
+    }
+}
+
+static inline void ref_draw_string(uint8_t *buf, uint32_t x, uint32_t y, uint32_t scale, const uint8_t *font, const char *s) {
+    for (int32_t x_n = x; *s; x_n += (font[1] + font[2]) * scale)
+        ref_draw_char(buf, x_n, y, scale, font, *(s++));
+}
+
+/* ssd1306_draw_line original: inclinacao em float, um pixel por coluna.
+ * O swap() original copiava o ponteiro, entao aqui as pontas nunca sao trocadas
+ * corretamente quando x1 > x2 (mesmo comportamento do driver antigo). */
+static inline void ref_swap(int32_t *a, int32_t *b) {
+    int32_t *t = a;
+    *a = *b;
+    *b = *t;
+}
+
+static inline void ref_draw_line(uint8_t *buf, int32_t x1, int32_t y1, int32_t x2, int32_t y2) {
+    if (x1 > x2) {
+        ref_swap(&x1, &x2);
+        ref_swap(&y1, &y2);
+    }
+
+    if (x1 == x2) {
+        if (y1 > y2)
+            ref_swap(&y1, &y2);
+        for (int32_t i = y1; i <= y2; ++i)
+            ref_draw_pixel(buf, x1, i);
+        return;
+    }
+
+    float m = (float)(y2 - y1) / (float)(x2 - x1);
+    for (int32_t i = x1; i <= x2; ++i) {
+        float y = m * (float)(i - x1) + (float)y1;
+        ref_draw_pixel(buf, i, (uint32_t)y);
+    }
+}
+
+/* Bresenham sem recorte, pixel a pixel com teste de borda */
+static inline void ref_bresenham(uint8_t *buf, int32_t x1, int32_t y1, int32_t x2, int32_t y2) {
+    int32_t dx = x2 > x1 ? x2 - x1 : x1 - x2, sx = x1 < x2 ? 1 : -1;
+    int32_t dy = y2 > y1 ? y1 - y2 : y2 - y1, sy = y1 < y2 ? 1 : -1;
+    int32_t err = dx + dy;
+    for (;;) {
+        if (x1 >= 0 && y1 >= 0)
+            ref_draw_pixel(buf, x1, y1);
+        if (x1 == x2 && y1 == y2) break;
+        int32_t e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x1 += sx; }
+        if (e2 <= dx) { err += dx; y1 += sy; }
+    }
+}
+
+static inline bool ref_get_pixel(const uint8_t *buf, int32_t x, int32_t y) {
+    if (x < 0 || y < 0 || x >= FRAME_W || y >= FRAME_H) return false;
+    return buf[x + FRAME_W * (y >> 3)] >> (y & 7) & 1;
+}
+
+#endif
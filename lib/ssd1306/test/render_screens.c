@@ -0,0 +1,61 @@
+/*
+ * Renderiza as telas do galton_board e do checkin no emulador ssd1306_host e
+ * grava cada uma como PBM, com bytes e transferencias gastos no barramento.
+ *
+ * Compilar e rodar (a partir de lib/ssd1306):
+ *   gcc -std=c11 -O2 -DSSD1306_HOST -Iinclude test/render_screens.c src/ssd1306_i2c.c src/ssd1306_host.c -o render_screens && ./render_screens [pasta]
+ */
+#include <stdio.h>
+#include <string.h>
+#include "ssd1306.h"
+#include "ssd1306_host.h"
+#include "frames.h"
+
+static ssd1306_host_t host;
+static ssd1306_t disp;
+static const char *outdir = ".";
+
+static int dump(const char *name) {
+    char path[256];
+    snprintf(path, sizeof path, "%s/%s.pbm", outdir, name);
+
+    ssd1306_host_reset_counters(&host);
+    ssd1306_show(&disp);
+
+    FILE *f = fopen(path, "wb");
+    if (!f || !ssd1306_host_write_pbm(&host, FRAME_W, FRAME_H, f)) {
+        printf("erro gravando %s\n", path);
+        if (f) fclose(f);
+        return 1;
+    }
+    fclose(f);
+    printf("%-28s %5zu bytes %3zu transferencias\n", path, host.bytes, host.transfers);
+    return memcmp(host.ram, disp.buffer, disp.bufsize) != 0;
+}
+
+int main(int argc, char **argv) {
+    galton_state_t g = {0};
+    int err = 0;
+
+    if (argc > 1)
+        outdir = argv[1];
+
+    ssd1306_host_reset(&host);
+    ssd1306_init_backend(&disp, FRAME_W, FRAME_H, 0x3c, &ssd1306_host_backend, &host);
+
+    srand(1);
+    for (int i = 0; i < 400; i++)
+        galton_step(&g);
+
+    draw_galton_balls(&disp, &g);
+    err |= dump("galton_bolas");
+    draw_galton_hist(&disp, &g);
+    err |= dump("galton_histograma");
+    draw_checkin(&disp, 0, 12);
+    err |= dump("checkin_terreo");
+    draw_checkin(&disp, 3, 47);
+    err |= dump("checkin_andar3");
+
+    ssd1306_deinit(&disp);
+    return err;
+}
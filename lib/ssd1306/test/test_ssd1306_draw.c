@@ -0,0 +1,428 @@
+/*
+ * Teste host das rotinas de desenho do ssd1306: o resultado no buffer deve ser
+ * identico ao das versoes originais pixel a pixel (reference.h).
+ *
+ * Compilar e rodar (a partir de lib/ssd1306):
+ *   gcc -std=c11 -O2 -DSSD1306_HOST -Iinclude test/test_ssd1306_draw.c src/ssd1306_i2c.c src/ssd1306_text_cache.c src/ssd1306_host.c -o test_draw && ./test_draw
+ */
+#include <stdio.h>
+#include <string.h>
+#include "ssd1306.h"
+#include "ssd1306_host.h"
+#include "ssd1306_font.h"
+#include "ssd1306_font_atlas.h"
+#include "ssd1306_text_cache.h"
+#include "frames.h"
+#include "reference.h"
+#include "../tools/ssd1306_image_encode.h"
+
+static ssd1306_host_t host;
+
+static int failures;
+#define CHECK(cond) do { if (!(cond)) { printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+static ssd1306_t disp;
+static uint8_t expected[FRAME_W * FRAME_H / 8];
+
+static void reset(void) {
+    ssd1306_clear(&disp);
+    memset(expected, 0, sizeof expected);
+}
+
+static bool same(void) {
+    return memcmp(disp.buffer, expected, sizeof expected) == 0;
+}
+
+/* todos os caracteres da fonte, em todas as linhas, inclusive cortados nas bordas */
+static void test_text_matches_reference(void) {
+    static const uint32_t xs[] = {0, 1, 61, 122, 124, 127};
+    char s[2] = {0, 0};
+
+    for (int c = font_8x5[3]; c <= font_8x5[4]; c++) {
+        s[0] = (char)c;
+        for (size_t i = 0; i < sizeof xs / sizeof xs[0]; i++) {
+            for (uint32_t y = 0; y < FRAME_H + 2; y++) {
+                reset();
+                ssd1306_draw_string(&disp, xs[i], y, 1, s);
+                ref_draw_string(expected, xs[i], y, 1, font_8x5, s);
+                if (!same()) {
+                    printf("FAIL char '%c' x=%u y=%u\n", c, xs[i], y);
+                    failures++;
+                    return;
+                }
+            }
+        }
+    }
+
+    reset();
+    ssd1306_draw_string(&disp, 3, 13, 1, "Andar 4: 37 pessoas");
+    ref_draw_string(expected, 3, 13, 1, font_8x5, "Andar 4: 37 pessoas");
+    CHECK(same());
+}
+
+static void test_text_marks_window(void) {
+    reset();
+    ssd1306_show(&disp);
+    ssd1306_draw_string(&disp, 10, 12, 1, "ab");
+    /* "ab": colunas 10..20, linhas 12..19 -> paginas 1..2 */
+    CHECK(disp.dirty.x0 == 10 && disp.dirty.x1 == 20);
+    CHECK(disp.dirty.p0 == 1 && disp.dirty.p1 == 2);
+}
+
+/* primeira coluna com tinta de um buffer, ou FRAME_W */
+static uint32_t first_ink_col(const uint8_t *buf) {
+    for (uint32_t x = 0; x < FRAME_W; x++)
+        for (uint32_t y = 0; y < FRAME_H; y++)
+            if (ref_get_pixel(buf, x, y))
+                return x;
+    return FRAME_W;
+}
+
+/* glifo do atlas = glifo original sem as colunas vazias da esquerda, em qualquer escala */
+static void test_atlas_matches_font(void) {
+    static uint8_t ref[FRAME_W * FRAME_H / 8];
+    static const uint32_t ys[] = {0, 5, 8, 13};
+
+    for (uint32_t scale = 1; scale <= 3; scale++) {
+        for (size_t i = 0; i < sizeof ys / sizeof ys[0]; i++) {
+            for (int c = font_8x5[3]; c <= font_8x5[4]; c++) {
+                memset(ref, 0, sizeof ref);
+                ref_draw_char(ref, 20, ys[i], scale, font_8x5, (char)c);
+                const uint32_t x0 = first_ink_col(ref);
+
+                reset();
+                ssd1306_draw_char_with_atlas(&disp, 20, ys[i], scale, &atlas_8x5, (char)c);
+                if (x0 == FRAME_W) {
+                    CHECK(first_ink_col(disp.buffer) == FRAME_W);
+                    continue;
+                }
+                /* digitos ficam com a largura cheia: comparar a partir da coluna 20 */
+                const uint32_t shift = (c >= '0' && c <= '9') ? 0 : x0 - 20;
+                ref_draw_char(expected, 20 - shift, ys[i], scale, font_8x5, (char)c);
+                if (!same()) {
+                    printf("FAIL atlas '%c' escala %u y=%u\n", c, scale, ys[i]);
+                    failures++;
+                    return;
+                }
+            }
+        }
+    }
+}
+
+static void test_atlas_string(void) {
+    /* proporcional: "il" ocupa menos que dois glifos de 5 colunas */
+    CHECK(ssd1306_string_width_with_atlas(&atlas_8x5, 1, "il") < 2 * 5 + 1);
+    /* digitos com largura fixa: o contador nao muda de largura */
+    CHECK(ssd1306_string_width_with_atlas(&atlas_8x5, 1, "11") == ssd1306_string_width_with_atlas(&atlas_8x5, 1, "88"));
+    /* kerning: "Ta" encosta 1 px */
+    CHECK(ssd1306_string_width_with_atlas(&atlas_8x5, 1, "Ta") + 1 ==
+          ssd1306_string_width_with_atlas(&atlas_8x5, 1, "T") + 1 + ssd1306_string_width_with_atlas(&atlas_8x5, 1, "a"));
+
+    static const char *const texts[] = {"Terreo: 12 pessoas", "Andar 3: 47 pessoas", "Tty, Ya."};
+    for (size_t i = 0; i < sizeof texts / sizeof texts[0]; i++) {
+        for (uint32_t scale = 1; scale <= 2; scale++) {
+            reset();
+            const uint32_t w = ssd1306_string_width_with_atlas(&atlas_8x5, scale, texts[i]);
+            ssd1306_draw_string_with_atlas(&disp, 0, 0, scale, &atlas_8x5, texts[i]);
+            /* a largura calculada termina na ultima coluna com tinta */
+            uint32_t last = 0;
+            for (uint32_t x = 0; x < FRAME_W; x++)
+                for (uint32_t y = 0; y < FRAME_H; y++)
+                    if (ref_get_pixel(disp.buffer, x, y))
+                        last = x;
+            CHECK(w > FRAME_W || last + 1 == w);
+        }
+    }
+
+    /* digitos grandes: 16 linhas, "12/50" em 2 paginas */
+    reset();
+    ssd1306_show(&disp);
+    const uint32_t end = ssd1306_draw_string_with_atlas(&disp, 4, 8, 1, &atlas_digits_16, "12/50");
+    CHECK(end == 4 + ssd1306_string_width_with_atlas(&atlas_digits_16, 1, "12/50") + 2);
+    CHECK(disp.dirty.p0 == 1 && disp.dirty.p1 == 2);
+    CHECK(ref_get_pixel(disp.buffer, 4 + 12 + 1, 8) && !ref_get_pixel(disp.buffer, 4 + 12 + 1, 8 + 15));
+}
+
+/* o cache desenha exatamente o mesmo que o desenho direto, inclusive cortado nas bordas */
+static void test_text_cache(void) {
+    static ssd1306_text_cache_t cache;
+    static uint8_t direct[FRAME_W * FRAME_H / 8];
+    static const char *const texts[] = {"Terreo:", "Andar 3:", "Contador:", "Botao B:", " pessoas", "Tty, Ya."};
+    static const uint32_t xs[] = {0, 7, 100, 127};
+    static const uint32_t ys[] = {0, 5, 16, 60};
+
+    ssd1306_text_cache_init(&cache);
+    for (size_t t = 0; t < sizeof texts / sizeof texts[0]; t++) {
+        for (uint32_t scale = 1; scale <= 2; scale++) {
+            for (size_t i = 0; i < sizeof xs / sizeof xs[0]; i++) {
+                for (size_t j = 0; j < sizeof ys / sizeof ys[0]; j++) {
+                    for (int atlas = 0; atlas < 2; atlas++) {
+                        reset();
+                        const uint32_t end_direct = atlas
+                            ? ssd1306_draw_string_with_atlas(&disp, xs[i], ys[j], scale, &atlas_8x5, texts[t])
+                            : xs[i] + (uint32_t)strlen(texts[t]) * 6 * scale;
+                        if (!atlas)
+                            ssd1306_draw_string(&disp, xs[i], ys[j], scale, texts[t]);
+                        memcpy(direct, disp.buffer, sizeof direct);
+
+                        reset();
+                        const uint32_t end_cached = atlas
+                            ? ssd1306_draw_cached_string_with_atlas(&disp, &cache, xs[i], ys[j], scale, &atlas_8x5, texts[t])
+                            : ssd1306_draw_cached_string_with_font(&disp, &cache, xs[i], ys[j], scale, font_8x5, texts[t]);
+                        if (memcmp(direct, disp.buffer, sizeof direct) != 0 || end_direct != end_cached) {
+                            printf("FAIL cache \"%s\" escala %u x=%u y=%u atlas=%d\n", texts[t], scale, xs[i], ys[j], atlas);
+                            failures++;
+                            return;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    /* "Terreo:" em escala 1 ficou no cache: uma renderizacao so */
+    ssd1306_text_cache_init(&cache);
+    for (int i = 0; i < 10; i++)
+        ssd1306_draw_cached_string_with_font(&disp, &cache, 0, 0, 1, font_8x5, "Terreo:");
+    CHECK(cache.misses == 1 && cache.hits == 9);
+
+    /* LRU: com todas as entradas ocupadas, sai a usada ha mais tempo */
+    ssd1306_text_cache_init(&cache);
+    char s[8];
+    for (int i = 0; i < SSD1306_TEXT_CACHE_ENTRIES; i++) {
+        snprintf(s, sizeof s, "k%d", i);
+        ssd1306_draw_cached_string_with_font(&disp, &cache, 0, 0, 1, font_8x5, s);
+    }
+    ssd1306_draw_cached_string_with_font(&disp, &cache, 0, 0, 1, font_8x5, "k0");   /* k1 vira a mais antiga */
+    ssd1306_draw_cached_string_with_font(&disp, &cache, 0, 0, 1, font_8x5, "novo");
+    CHECK(cache.misses == SSD1306_TEXT_CACHE_ENTRIES + 1 && cache.hits == 1);
+    ssd1306_draw_cached_string_with_font(&disp, &cache, 0, 0, 1, font_8x5, "k0");
+    CHECK(cache.hits == 2);
+    ssd1306_draw_cached_string_with_font(&disp, &cache, 0, 0, 1, font_8x5, "k1");
+    CHECK(cache.misses == SSD1306_TEXT_CACHE_ENTRIES + 2);
+
+    /* texto maior que uma entrada e desenhado direto, igual */
+    reset();
+    ssd1306_draw_string(&disp, 0, 3, 2, "Andar 4: 37 pessoas");
+    memcpy(direct, disp.buffer, sizeof direct);
+    reset();
+    ssd1306_draw_cached_string_with_font(&disp, &cache, 0, 3, 2, font_8x5, "Andar 4: 37 pessoas");
+    CHECK(memcmp(direct, disp.buffer, sizeof direct) == 0);
+}
+
+static uint32_t lcg(void);
+
+/* imagem crua e RLE voltam exatamente ao quadro original */
+static void test_image_roundtrip(void) {
+    static uint8_t frame[FRAME_W * FRAME_H / 8], rle[SSD1306_IMAGE_RLE_MAX(sizeof frame)];
+    galton_state_t g = {0};
+
+    srand(1);
+    for (int i = 0; i < 300; i++)
+        galton_step(&g);
+
+    for (int screen = 0; screen < 3; screen++) {
+        if (screen == 0) draw_galton_balls(&disp, &g);
+        if (screen == 1) draw_galton_hist(&disp, &g);
+        if (screen == 2) draw_checkin(&disp, 3, 47);
+        memcpy(frame, disp.buffer, sizeof frame);
+
+        const size_t len = ssd1306_image_rle(frame, sizeof frame, rle);
+        const ssd1306_image_t raw_img = {FRAME_W, FRAME_H / 8, SSD1306_IMAGE_RAW, sizeof frame, frame};
+        const ssd1306_image_t rle_img = {FRAME_W, FRAME_H / 8, SSD1306_IMAGE_RLE, (uint16_t)len, rle};
+        CHECK(len < sizeof frame);
+
+        memset(disp.buffer, 0x5a, disp.bufsize);
+        ssd1306_draw_image(&disp, 0, 0, &raw_img);
+        CHECK(memcmp(frame, disp.buffer, sizeof frame) == 0);
+        memset(disp.buffer, 0xa5, disp.bufsize);
+        ssd1306_draw_image(&disp, 0, 0, &rle_img);
+        CHECK(memcmp(frame, disp.buffer, sizeof frame) == 0);
+
+        /* dados truncados param no fim, sem ler alem */
+        const ssd1306_image_t cut = {FRAME_W, FRAME_H / 8, SSD1306_IMAGE_RLE, (uint16_t)(len / 2), rle};
+        ssd1306_draw_image(&disp, 0, 0, &cut);
+    }
+}
+
+/* icone em posicoes quaisquer: troca so os pixels sob ele, o resto do buffer fica */
+static void test_image_offsets(void) {
+    static uint8_t pixels[20 * 13], pages[20 * 2], rle[SSD1306_IMAGE_RLE_MAX(sizeof pages)];
+    static uint8_t before[FRAME_W * FRAME_H / 8];
+
+    for (int n = 0; n < 2000; n++) {
+        for (size_t i = 0; i < sizeof pixels; i++)
+            pixels[i] = (lcg() & 3) == 0 || (i % 20) < 4;   /* corridas e ruido */
+        ssd1306_image_pack(pixels, 20, 13, pages);
+        const int use_rle = n & 1;
+        const size_t len = use_rle ? ssd1306_image_rle(pages, sizeof pages, rle) : sizeof pages;
+        const ssd1306_image_t img = {20, 2, use_rle ? SSD1306_IMAGE_RLE : SSD1306_IMAGE_RAW, (uint16_t)len, use_rle ? rle : pages};
+
+        const uint32_t x = lcg() % (FRAME_W + 4), y = lcg() % (FRAME_H + 4);
+        for (size_t i = 0; i < disp.bufsize; i++)
+            disp.buffer[i] = (uint8_t)lcg();
+        memcpy(before, disp.buffer, sizeof before);
+        ssd1306_draw_image(&disp, x, y, &img);
+
+        for (uint32_t py = 0; py < FRAME_H; py++) {
+            for (uint32_t px = 0; px < FRAME_W; px++) {
+                /* a imagem cobre 2 paginas inteiras (16 linhas), as 3 de baixo apagadas */
+                const bool inside = x < FRAME_W && y < FRAME_H && px >= x && px < x + 20 && py >= y && py < y + 16;
+                const bool want = inside ? (py - y < 13 && pixels[(py - y) * 20 + (px - x)])
+                                         : ref_get_pixel(before, px, py);
+                if (ref_get_pixel(disp.buffer, px, py) != want) {
+                    printf("FAIL imagem x=%u y=%u pixel %u,%u\n", x, y, px, py);
+                    failures++;
+                    return;
+                }
+            }
+        }
+    }
+}
+
+static uint32_t lcg(void) {
+    static uint32_t state = 12345;
+    state = state * 1103515245u + 12345u;
+    return state >> 8;
+}
+
+/* retangulos aleatorios, inclusive passando das bordas */
+static void test_fill_matches_reference(void) {
+    for (int n = 0; n < 5000; n++) {
+        uint32_t x = lcg() % (FRAME_W + 8), y = lcg() % (FRAME_H + 8);
+        uint32_t w = lcg() % 80, h = lcg() % 80;
+
+        reset();
+        ssd1306_draw_square(&disp, x, y, w, h);
+        ref_draw_square(expected, x, y, w, h);
+        if (!same()) {
+            printf("FAIL draw_square %u,%u %ux%u\n", x, y, w, h);
+            failures++;
+            return;
+        }
+
+        /* limpar por cima de uma tela cheia deixa o buraco do retangulo */
+        ssd1306_fill_square(&disp, 0, 0, FRAME_W, FRAME_H, SSD1306_FILL_SET);
+        ssd1306_clear_square(&disp, x, y, w, h);
+        for (size_t i = 0; i < sizeof expected; i++)
+            expected[i] = ~expected[i];
+        if (!same()) {
+            printf("FAIL clear_square %u,%u %ux%u\n", x, y, w, h);
+            failures++;
+            return;
+        }
+
+        /* xor duas vezes volta ao original */
+        ssd1306_fill_square(&disp, x, y, w, h, SSD1306_FILL_XOR);
+        ssd1306_fill_square(&disp, x, y, w, h, SSD1306_FILL_XOR);
+        if (!same()) {
+            printf("FAIL xor %u,%u %ux%u\n", x, y, w, h);
+            failures++;
+            return;
+        }
+    }
+}
+
+/* barra do histograma do galton_board.c */
+static void test_bar_window(void) {
+    reset();
+    ssd1306_show(&disp);
+    ssd1306_draw_square(&disp, 8, 63 - 20 + 1, 7, 20);
+    CHECK(disp.dirty.x0 == 8 && disp.dirty.x1 == 14);
+    CHECK(disp.dirty.p0 == 5 && disp.dirty.p1 == 7);
+    CHECK(disp.buffer[5 * FRAME_W + 8] == 0xf0);
+    CHECK(disp.buffer[7 * FRAME_W + 14] == 0xff);
+}
+
+/* pixel a no maximo ~1 px da reta ideal e dentro do retangulo do segmento */
+static bool near_segment(int32_t x, int32_t y, int32_t x1, int32_t y1, int32_t x2, int32_t y2) {
+    int64_t dx = x2 - x1, dy = y2 - y1;
+    int64_t cross = dx * (y - y1) - dy * (x - x1);
+    int32_t lox = x1 < x2 ? x1 : x2, hix = x1 < x2 ? x2 : x1;
+    int32_t loy = y1 < y2 ? y1 : y2, hiy = y1 < y2 ? y2 : y1;
+    if (x < lox - 1 || x > hix + 1 || y < loy - 1 || y > hiy + 1)
+        return false;
+    return cross * cross <= 2 * (dx * dx + dy * dy);
+}
+
+static void test_lines(void) {
+    /* dentro da tela: igual ao Bresenham de referencia a partir da ponta esquerda,
+     * nos dois sentidos */
+    for (int n = 0; n < 5000; n++) {
+        int32_t x1 = lcg() % FRAME_W, y1 = lcg() % FRAME_H;
+        int32_t x2 = lcg() % FRAME_W, y2 = lcg() % FRAME_H;
+        if (x1 > x2) {
+            int32_t t = x1; x1 = x2; x2 = t;
+            t = y1; y1 = y2; y2 = t;
+        }
+
+        reset();
+        ssd1306_draw_line(&disp, x1, y1, x2, y2);
+        ref_bresenham(expected, x1, y1, x2, y2);
+        bool forward = same();
+
+        reset();
+        ssd1306_draw_line(&disp, x2, y2, x1, y1);
+        ref_bresenham(expected, x1, y1, x2, y2);
+        bool backward = same();
+
+        if (!forward || !backward) {
+            printf("FAIL line %d,%d -> %d,%d\n", x1, y1, x2, y2);
+            failures++;
+            return;
+        }
+    }
+
+    /* linha ingreme nao tem buracos: um pixel por linha */
+    reset();
+    ssd1306_draw_line(&disp, 10, 0, 14, 63);
+    for (int32_t y = 0; y < FRAME_H; y++) {
+        int count = 0;
+        for (int32_t x = 0; x < FRAME_W; x++)
+            count += ref_get_pixel(disp.buffer, x, y);
+        CHECK(count == 1);
+    }
+
+    /* fora da tela: recortada, perto da reta sem recorte */
+    for (int n = 0; n < 5000; n++) {
+        int32_t x1 = (int32_t)(lcg() % 600) - 300, y1 = (int32_t)(lcg() % 400) - 200;
+        int32_t x2 = (int32_t)(lcg() % 600) - 300, y2 = (int32_t)(lcg() % 400) - 200;
+
+        reset();
+        ssd1306_draw_line(&disp, x1, y1, x2, y2);
+        for (int32_t x = 0; x < FRAME_W; x++)
+            for (int32_t y = 0; y < FRAME_H; y++)
+                if (ref_get_pixel(disp.buffer, x, y) && !near_segment(x, y, x1, y1, x2, y2)) {
+                    printf("FAIL clipped line %d,%d -> %d,%d at %d,%d\n", x1, y1, x2, y2, x, y);
+                    failures++;
+                    return;
+                }
+    }
+
+    reset();
+    ssd1306_draw_line(&disp, -50, -10, -1, 200);
+    CHECK(same());
+}
+
+int main(void) {
+    ssd1306_host_reset(&host);
+    ssd1306_init_backend(&disp, FRAME_W, FRAME_H, 0x3c, &ssd1306_host_backend, &host);
+
+    test_text_matches_reference();
+    test_text_marks_window();
+    test_atlas_matches_font();
+    test_atlas_string();
+    test_text_cache();
+    test_image_roundtrip();
+    test_image_offsets();
+    test_fill_matches_reference();
+    test_bar_window();
+    test_lines();
+
+    ssd1306_deinit(&disp);
+    if (failures) {
+        printf("%d falha(s)\n", failures);
+        return 1;
+    }
+    printf("OK\n");
+    return 0;
+}
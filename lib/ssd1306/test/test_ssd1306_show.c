@@ -0,0 +1,323 @@
+/*
+ * Teste host do envio parcial (dirty window) do ssd1306_show e do scroll.
+ * Conta os bytes que iriam para o barramento I2C em quadros tipicos do
+ * galton_board e do checkin, e confere no emulador (ssd1306_host) que a RAM
+ * do display termina igual ao buffer.
+ *
+ * Compilar e rodar (a partir de lib/ssd1306):
+ *   gcc -std=c11 -O2 -DSSD1306_HOST -Iinclude test/test_ssd1306_show.c src/ssd1306_i2c.c src/ssd1306_host.c -o test_show && ./test_show
+ */
+#include <stdio.h>
+#include <string.h>
+#include "ssd1306.h"
+#include "ssd1306_host.h"
+#include "frames.h"
+
+static ssd1306_host_t host;
+
+static int failures;
+#define CHECK(cond) do { if (!(cond)) { printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+static void open_display(ssd1306_t *d) {
+    memset(d, 0, sizeof *d);
+    ssd1306_host_reset(&host);
+    ssd1306_init_backend(d, 128, 64, 0x3c, &ssd1306_host_backend, &host);
+}
+
+static bool ram_matches(const ssd1306_t *d) {
+    return memcmp(host.ram, d->buffer, d->bufsize) == 0;
+}
+
+static size_t show_bytes(ssd1306_t *d) {
+    ssd1306_host_reset_counters(&host);
+    ssd1306_show(d);
+    CHECK(ram_matches(d));
+    return host.bytes;
+}
+
+/* enderecamento: 0x00 + 6 bytes de comando numa unica transferencia */
+#define ADDR_BYTES (1 + 6)
+/* enderecamento + 0x40 + 1024 bytes */
+#define FULL_FRAME_BYTES (ADDR_BYTES + 1 + 1024)
+
+static void test_init_single_transfer(void) {
+    ssd1306_t d;
+    open_display(&d);
+    /* os 25 bytes de comando + 0x00 numa unica transferencia */
+    CHECK(host.transfers == 1);
+    CHECK(host.bytes == 1 + 25);
+    CHECK(host.display_on && host.mem_mode == 0);
+    ssd1306_deinit(&d);
+}
+
+/* struct reaproveitado ou na pilha: o init escolhe o transporte, nao le lixo */
+static void test_init_ignores_garbage(void) {
+    ssd1306_t d;
+    memset(&d, 0xa5, sizeof d);
+    d.external_vcc = false;
+    ssd1306_host_reset(&host);
+    CHECK(ssd1306_init_backend(&d, 128, 64, 0x3c, &ssd1306_host_backend, &host));
+    CHECK(d.backend == &ssd1306_host_backend && d.backend_ctx == &host);
+    CHECK(host.transfers == 1 && host.display_on);
+    CHECK(show_bytes(&d) == FULL_FRAME_BYTES);
+    ssd1306_deinit(&d);
+
+    memset(&d, 0xa5, sizeof d);
+    d.external_vcc = false;
+    CHECK(ssd1306_init(&d, 128, 64, 0x3c, NULL));
+    CHECK(d.backend == NULL && d.backend_ctx == NULL);
+    ssd1306_deinit(&d);
+}
+
+static void test_first_show_is_full(void) {
+    ssd1306_t d;
+    open_display(&d);
+    CHECK(show_bytes(&d) == FULL_FRAME_BYTES);
+    CHECK(show_bytes(&d) == 0);          /* nada mudou */
+    ssd1306_deinit(&d);
+}
+
+static void test_pixel_window(void) {
+    ssd1306_t d;
+    open_display(&d);
+    ssd1306_clear(&d);
+    show_bytes(&d);
+
+    ssd1306_draw_pixel(&d, 10, 20);
+    ssd1306_draw_pixel(&d, 12, 30);
+    /* colunas 10..12, paginas 2..3 -> 2 transferencias de 3 bytes + 0x40 */
+    CHECK(show_bytes(&d) == ADDR_BYTES + 2 * (3 + 1));
+    CHECK(host.transfers == 1 + 2);
+
+    /* apagar a tela so reenvia o que tinha tinta */
+    ssd1306_clear(&d);
+    CHECK(show_bytes(&d) == ADDR_BYTES + 2 * (3 + 1));
+    ssd1306_clear(&d);
+    CHECK(show_bytes(&d) == 0);
+    ssd1306_deinit(&d);
+}
+
+static void test_partial_preserves_buffer(void) {
+    ssd1306_t d;
+    open_display(&d);
+    ssd1306_clear(&d);
+    ssd1306_draw_pixel(&d, 127, 7);     /* ultimo byte da pagina 0 */
+    ssd1306_show(&d);
+    ssd1306_draw_pixel(&d, 0, 8);       /* usa o byte acima como prefixo 0x40 */
+    ssd1306_show(&d);
+    CHECK(d.buffer[127] == 0x80);
+    CHECK(d.buffer[128] == 0x01);
+    ssd1306_deinit(&d);
+}
+
+static void test_shadow_sends_only_changes(void) {
+    ssd1306_t d;
+    open_display(&d);
+    CHECK(ssd1306_shadow_init(&d));
+    CHECK(show_bytes(&d) == FULL_FRAME_BYTES);   /* preenche a copia */
+
+    draw_checkin(&d, 0, 3);
+    show_bytes(&d);
+    draw_checkin(&d, 0, 4);
+    /* so o digito muda: uma pagina, no maximo 5 colunas */
+    CHECK(show_bytes(&d) <= ADDR_BYTES + 1 + 5);
+    CHECK(host.transfers == 1 + 1);
+
+    /* redesenhar o mesmo quadro nao envia nada */
+    draw_checkin(&d, 0, 4);
+    CHECK(show_bytes(&d) == 0);
+
+    /* o que foi enviado bate com o buffer */
+    CHECK(memcmp(d.buffer, d.shadow, d.bufsize) == 0);
+    ssd1306_deinit(&d);
+}
+
+SSD1306_STATIC_STORAGE(oled_mem, 128, 64);
+SSD1306_STATIC_BUFFER(small_buf, 128, 32);
+
+static void test_static_storage(void) {
+    ssd1306_t d, h;
+    memset(&d, 0, sizeof d);
+    ssd1306_host_reset(&host);
+
+    /* buffer de 128x32 nao serve para 128x64 */
+    CHECK(!ssd1306_init_backend_static(&d, 128, 64, 0x3c, &ssd1306_host_backend, &host, small_buf, sizeof small_buf));
+    CHECK(d.buffer == NULL);
+
+    CHECK(ssd1306_init_backend_static(&d, 128, 64, 0x3c, &ssd1306_host_backend, &host, oled_mem.buffer, sizeof oled_mem.buffer));
+    CHECK(d.buffer == (uint8_t *)oled_mem.buffer + 4);
+    CHECK(ssd1306_shadow_init_static(&d, oled_mem.shadow, sizeof oled_mem.shadow));
+    CHECK(d.shadow == oled_mem.shadow);
+    CHECK(d.heap == 0);
+
+    /* mesmo trafego que a versao com malloc */
+    open_display(&h);
+    CHECK(ssd1306_shadow_init(&h));
+    CHECK(h.heap == (SSD1306_HEAP_BUFFER | SSD1306_HEAP_SHADOW));
+    ssd1306_clear(&d);
+    ssd1306_clear(&h);
+    CHECK(show_bytes(&d) == show_bytes(&h));
+    for (int i = 0; i < 10; i++) {
+        draw_checkin(&d, i % 5, i);
+        draw_checkin(&h, i % 5, i);
+        CHECK(show_bytes(&d) == show_bytes(&h));
+        CHECK(memcmp(d.buffer, h.buffer, d.bufsize) == 0);
+    }
+    ssd1306_deinit(&h);
+
+    /* deinit so solta os ponteiros, a memoria estatica continua valida */
+    ssd1306_deinit(&d);
+    CHECK(d.buffer == NULL && d.shadow == NULL);
+
+    CHECK(ssd1306_init_backend_static(&d, 128, 32, 0x3c, &ssd1306_host_backend, &host, small_buf, sizeof small_buf));
+    CHECK(d.bufsize == 512);
+    CHECK(!ssd1306_shadow_init_static(&d, oled_mem.shadow, 256));
+    // copia desalinhada: a comparacao por palavras daria HardFault no M0+
+    CHECK(!ssd1306_shadow_init_static(&d, oled_mem.shadow + 1, sizeof oled_mem.shadow - 1));
+    CHECK(d.shadow == NULL);
+    ssd1306_deinit(&d);
+}
+
+/* registro de eventos rolando para cima: cada linha nova so envia a pagina dela */
+static void test_start_line_ticker(void) {
+    ssd1306_t d;
+    char line[24];
+    size_t total = 0;
+    const int lines = 20;
+
+    open_display(&d);
+    CHECK(ssd1306_shadow_init(&d));
+    ssd1306_clear(&d);
+    show_bytes(&d);
+
+    for (int i = 0; i < lines; i++) {
+        /* a pagina do topo vira a ultima linha depois de avancar 8 linhas */
+        const uint32_t page = d.start_line / 8;
+        ssd1306_fill_square(&d, 0, page * 8, 128, 8, SSD1306_FILL_CLEAR);
+        snprintf(line, sizeof line, "Andar %d: +1", i % 5);
+        ssd1306_draw_string(&d, 0, page * 8, 1, line);
+        total += show_bytes(&d);
+        ssd1306_start_line(&d, d.start_line + 8);
+        total += host.bytes;
+
+        /* a linha nova aparece embaixo */
+        CHECK(host.start_line == d.start_line);
+        for (uint32_t x = 0; x < 128; x++)
+            for (uint32_t y = 0; y < 8; y++)
+                CHECK(ssd1306_host_pixel(&host, x, 56 + y) == ((d.buffer[page * 128 + x] >> y) & 1));
+    }
+    printf("ticker           : %5zu bytes/linha (cheio: %d)\n", total / lines, FULL_FRAME_BYTES);
+    /* uma pagina no maximo + o comando de start line (0x00 + 1 byte) */
+    CHECK(total / lines <= ADDR_BYTES + 1 + 128 + 2);
+    ssd1306_deinit(&d);
+}
+
+static void test_hardware_scroll(void) {
+    ssd1306_t d;
+    open_display(&d);
+    ssd1306_clear(&d);
+    ssd1306_draw_pixel(&d, 0, 0);
+    ssd1306_draw_pixel(&d, 0, 63);
+    show_bytes(&d);
+
+    /* so comandos: paginas 0..7 para a direita */
+    ssd1306_host_reset_counters(&host);
+    ssd1306_scroll(&d, SSD1306_SCROLL_RIGHT, 0, 7, SSD1306_SCROLL_5_FRAMES, 0);
+    CHECK(host.transfers == 1 && host.data_bytes == 0);
+    CHECK(host.scrolling && host.scroll[0] == SET_HSCROLL);
+
+    ssd1306_host_scroll_step(&host);
+    ssd1306_host_scroll_step(&host);
+    CHECK(host.ram[0][2] == 0x01 && host.ram[0][0] == 0);
+    CHECK(host.ram[7][2] == 0x80);
+
+    /* durante o scroll a RAM nao pode ser escrita: o desenho fica pendente */
+    ssd1306_draw_pixel(&d, 64, 32);
+    ssd1306_host_reset_counters(&host);
+    ssd1306_show(&d);
+    CHECK(host.bytes == 0);
+    CHECK(host.scroll_writes == 0);
+
+    /* parar reenvia tudo, a RAM volta a bater com o buffer */
+    ssd1306_scroll_stop(&d);
+    CHECK(!host.scrolling);
+    CHECK(show_bytes(&d) == FULL_FRAME_BYTES);
+
+    /* vertical + horizontal para a esquerda so na area de baixo */
+    ssd1306_scroll_area(&d, 16, 48);
+    ssd1306_scroll(&d, SSD1306_SCROLL_LEFT, 2, 7, SSD1306_SCROLL_2_FRAMES, 1);
+    CHECK(host.scroll[0] == SET_VHSCROLL + 1 && host.scroll[5] == 1);
+    CHECK(host.vscroll_top == 16 && host.vscroll_rows == 48);
+    ssd1306_host_scroll_step(&host);
+    CHECK(host.ram[0][0] == 0x01);          /* pagina 0 fora do scroll */
+    CHECK(host.ram[7][127] == 0x80);
+    CHECK(host.start_line == 17);
+    ssd1306_scroll_stop(&d);
+    ssd1306_deinit(&d);
+}
+
+static void report_galton(void) {
+    ssd1306_t d;
+    galton_state_t g = {0};
+    size_t balls = 0, hist = 0;
+    const int frames = 200;
+
+    srand(1);
+    open_display(&d);
+    ssd1306_clear(&d);
+    show_bytes(&d);
+    for (int i = 0; i < frames; i++) {
+        galton_step(&g);
+        draw_galton_balls(&d, &g);
+        balls += show_bytes(&d);
+    }
+    for (int i = 0; i < frames; i++) {
+        galton_step(&g);
+        draw_galton_hist(&d, &g);
+        hist += show_bytes(&d);
+    }
+    printf("galton bolas     : %5zu bytes/quadro (cheio: %d)\n", balls / frames, FULL_FRAME_BYTES);
+    printf("galton histograma: %5zu bytes/quadro (cheio: %d)\n", hist / frames, FULL_FRAME_BYTES);
+    CHECK(balls / frames < FULL_FRAME_BYTES);
+    CHECK(hist / frames < FULL_FRAME_BYTES);
+    ssd1306_deinit(&d);
+}
+
+static void report_checkin(void) {
+    ssd1306_t d;
+    size_t total = 0;
+    const int frames = 50;
+
+    open_display(&d);
+    ssd1306_clear(&d);
+    show_bytes(&d);
+    for (int i = 0; i < frames; i++) {
+        draw_checkin(&d, i % 5, i % 50);
+        total += show_bytes(&d);
+    }
+    printf("checkin          : %5zu bytes/quadro (cheio: %d)\n", total / frames, FULL_FRAME_BYTES);
+    /* texto so ocupa a pagina 0 */
+    CHECK(total / frames <= ADDR_BYTES + 1 + 128);
+    ssd1306_deinit(&d);
+}
+
+int main(void) {
+    test_init_single_transfer();
+    test_init_ignores_garbage();
+    test_first_show_is_full();
+    test_pixel_window();
+    test_partial_preserves_buffer();
+    test_shadow_sends_only_changes();
+    test_static_storage();
+    test_start_line_ticker();
+    test_hardware_scroll();
+    report_galton();
+    report_checkin();
+
+    if (failures) {
+        printf("%d falha(s)\n", failures);
+        return 1;
+    }
+    printf("OK\n");
+    return 0;
+}
@@ -0,0 +1,291 @@
+/*
+ * Gerador do atlas de fontes (include/ssd1306_font_atlas.h).
+ *
+ * Decodifica uma vez, no PC, o que ssd1306_draw_char_with_font recalcula a
+ * cada caractere: cabecalho da fonte, bytes por coluna e posicao do glifo.
+ * Para cada glifo guarda so as colunas com tinta, a largura e o avanco
+ * (texto proporcional), e calcula a tabela de kerning dos pares que podem
+ * encostar 1 pixel sem que as tintas se toquem.
+ *
+ * Tambem gera a fonte grande de digitos (16 linhas, estilo 7 segmentos)
+ * usada nos contadores do checkin e do galton_board.
+ *
+ * Compilar e rodar (a partir de lib/ssd1306):
+ *   gcc -std=c11 -O2 -Iinclude tools/gen_font_atlas.c -o gen_font_atlas && ./gen_font_atlas > include/ssd1306_font_atlas.h
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "ssd1306_font.h"
+
+#define MAX_GLYPHS 96
+#define MAX_W      16
+#define MAX_H      32
+#define NO_INK     MAX_W
+
+typedef struct {
+    const char *name;       /* prefixo dos arrays gerados */
+    const char *comment;
+    uint8_t height, width, spacing;
+    char first, last;
+    const uint8_t *data;    /* formato de ssd1306_font.h, sem o cabecalho */
+    uint8_t space_advance;  /* avanco dos glifos sem tinta */
+    int tabular_digits;     /* digitos mantem a largura cheia (contadores nao tremem) */
+    int kerning;
+} font_src_t;
+
+typedef struct {
+    uint16_t offset_cols;
+    uint8_t width, advance;
+    uint8_t first_col;                  /* primeira coluna com tinta na fonte original */
+    uint8_t left[MAX_H], right[MAX_H];  /* colunas vazias a esquerda/direita por linha */
+} glyph_info_t;
+
+static uint32_t column_bits(const font_src_t *f, int glyph, int col) {
+    const int parts = (f->height + 7) / 8;
+    const uint8_t *src = f->data + (glyph * f->width + col) * parts;
+    uint32_t bits = 0;
+    for (int lp = 0; lp < parts; lp++)
+        bits |= (uint32_t) src[lp] << (8 * lp);
+    return f->height < 32 ? bits & ((1u << f->height) - 1) : bits;
+}
+
+/* --- fonte grande de digitos ------------------------------------------- */
+
+#define BIG_W 10
+#define BIG_H 16
+#define BIG_FIRST '-'
+#define BIG_LAST  ':'
+
+static uint8_t big_digits[(BIG_LAST - BIG_FIRST + 1) * BIG_W * 2];
+
+static void big_set(int glyph, int x, int y) {
+    uint8_t *col = big_digits + (glyph * BIG_W + x) * 2;
+    col[y >> 3] |= 1u << (y & 7);
+}
+
+static void big_rect(int glyph, int x0, int y0, int x1, int y1) {
+    for (int x = x0; x <= x1; x++)
+        for (int y = y0; y <= y1; y++)
+            big_set(glyph, x, y);
+}
+
+/* segmentos a..g com traco de 2 px; a linha 15 fica livre abaixo do texto */
+static void big_segments(int glyph, const char *segs) {
+    for (; *segs; segs++) {
+        switch (*segs) {
+        case 'a': big_rect(glyph, 1, 0, 8, 1); break;
+        case 'b': big_rect(glyph, 8, 1, 9, 7); break;
+        case 'c': big_rect(glyph, 8, 7, 9, 13); break;
+        case 'd': big_rect(glyph, 1, 13, 8, 14); break;
+        case 'e': big_rect(glyph, 0, 7, 1, 13); break;
+        case 'f': big_rect(glyph, 0, 1, 1, 7); break;
+        case 'g': big_rect(glyph, 1, 7, 8, 8); break;
+        }
+    }
+}
+
+static void build_big_digits(void) {
+    static const char *const digits[10] = {
+        "abcdef", "bc", "abged", "abgcd", "fgbc", "afgcd", "afgedc", "abc", "abcdefg", "abcdfg",
+    };
+    for (int d = 0; d < 10; d++)
+        big_segments('0' - BIG_FIRST + d, digits[d]);
+
+    big_segments('-' - BIG_FIRST, "g");
+    big_rect('.' - BIG_FIRST, 4, 13, 5, 14);
+    big_rect(':' - BIG_FIRST, 4, 3, 5, 4);
+    big_rect(':' - BIG_FIRST, 4, 10, 5, 11);
+    for (int y = 0; y <= 14; y++) {     /* barra de 2 px de (8,0) a (1,14) */
+        const int x = 1 + (14 - y) * 7 / 14;
+        big_rect('/' - BIG_FIRST, x, y, x + 1, y);
+    }
+}
+
+/* --- atlas --------------------------------------------------------------- */
+
+static int is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+static void analyse(const font_src_t *f, glyph_info_t *g, int count) {
+    uint16_t offset = 0;
+
+    for (int i = 0; i < count; i++) {
+        int c0 = f->width, c1 = -1;
+        for (int col = 0; col < f->width; col++) {
+            if (column_bits(f, i, col)) {
+                if (c0 > col) c0 = col;
+                c1 = col;
+            }
+        }
+        if (c1 >= 0 && f->tabular_digits && is_digit(f->first + i)) {
+            c0 = 0;
+            c1 = f->width - 1;
+        }
+
+        g[i].offset_cols = offset;
+        if (c1 < 0) {
+            g[i].first_col = 0;
+            g[i].width = 0;
+            g[i].advance = f->space_advance;
+        } else {
+            g[i].first_col = c0;
+            g[i].width = c1 - c0 + 1;
+            g[i].advance = g[i].width + f->spacing;
+        }
+        offset += g[i].width;
+
+        for (int y = 0; y < f->height; y++) {
+            g[i].left[y] = g[i].right[y] = NO_INK;
+            for (int col = 0; col < g[i].width; col++) {
+                if ((column_bits(f, i, c0 + col) >> y) & 1) {
+                    if (g[i].left[y] == NO_INK) g[i].left[y] = col;
+                    g[i].right[y] = g[i].width - 1 - col;
+                }
+            }
+        }
+    }
+}
+
+/* encostar 1 px so se, ate na diagonal, continuar sobrando 1 coluna vazia entre as tintas */
+static int kern_pair(const font_src_t *f, const glyph_info_t *a, const glyph_info_t *b) {
+    if (!a->width || !b->width)
+        return 0;
+
+    for (int y = 0; y < f->height; y++) {
+        for (int dy = -1; dy <= 1; dy++) {
+            const int yb = y + dy;
+            if (yb < 0 || yb >= f->height)
+                continue;
+            if (a->right[y] + b->left[yb] + f->spacing - 1 < 1)
+                return 0;
+        }
+    }
+    return -1;
+}
+
+static int kernable(char c) {
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || c == '.' || c == ',' || c == ':';
+}
+
+static void print_char_comment(char c) {
+    if (c == '\\' || c == '\'')
+        printf("'\\%c'", c);
+    else
+        printf("'%c'", c);
+}
+
+static void emit(const font_src_t *f) {
+    static glyph_info_t g[MAX_GLYPHS];
+    const int count = f->last - f->first + 1;
+    const int parts = (f->height + 7) / 8;
+    uint16_t kern_start[MAX_GLYPHS], kern_count[MAX_GLYPHS];
+    int kern_total = 0;
+
+    analyse(f, g, count);
+
+    printf("/* %s */\n", f->comment);
+    printf("static const uint8_t %s_cols[] = {\n", f->name);
+    for (int i = 0; i < count; i++) {
+        if (!g[i].width)
+            continue;
+        printf("    ");
+        for (int col = 0; col < g[i].width; col++) {
+            const uint32_t bits = column_bits(f, i, g[i].first_col + col);
+            for (int lp = 0; lp < parts; lp++)
+                printf("0x%02X,", (bits >> (8 * lp)) & 0xff);
+        }
+        printf(" /* ");
+        print_char_comment(f->first + i);
+        printf(" */\n");
+    }
+    printf("};\n\n");
+
+    for (int i = 0; i < count; i++) {
+        kern_start[i] = kern_total;
+        kern_count[i] = 0;
+        if (!f->kerning || !kernable(f->first + i))
+            continue;
+        for (int j = 0; j < count; j++)
+            if (kernable(f->first + j) && kern_pair(f, &g[i], &g[j]))
+                kern_count[i]++;
+        kern_total += kern_count[i];
+    }
+
+    if (kern_total) {
+        printf("static const ssd1306_kern_t %s_kern[] = {\n", f->name);
+        for (int i = 0; i < count; i++) {
+            if (!kern_count[i])
+                continue;
+            printf("    ");
+            for (int j = 0; j < count; j++) {
+                if (kernable(f->first + j) && kern_pair(f, &g[i], &g[j])) {
+                    printf("{");
+                    print_char_comment(f->first + j);
+                    printf(",-1},");
+                }
+            }
+            printf(" /* ");
+            print_char_comment(f->first + i);
+            printf(" */\n");
+        }
+        printf("};\n\n");
+    }
+
+    printf("static const ssd1306_glyph_t %s_glyphs[] = {\n", f->name);
+    for (int i = 0; i < count; i++) {
+        printf("    {%3u, %2u, %2u, %4u, %2u}, /* ", g[i].offset_cols, g[i].width, g[i].advance,
+               kern_start[i], kern_count[i]);
+        print_char_comment(f->first + i);
+        printf(" */\n");
+    }
+    printf("};\n\n");
+
+    printf("static const ssd1306_atlas_t %s = {\n", f->name);
+    printf("    %u, %d, ", f->height, parts);
+    print_char_comment(f->first);
+    printf(", ");
+    print_char_comment(f->last);
+    printf(", %s_glyphs, %s_cols, %s%s\n", f->name, f->name, kern_total ? f->name : "NULL", kern_total ? "_kern" : "");
+    printf("};\n\n");
+}
+
+int main(void) {
+    build_big_digits();
+
+    const font_src_t fonts[] = {
+        {
+            .name = "atlas_8x5",
+            .comment = "font_8x5 proporcional: 8 linhas, digitos com largura fixa, espaco de 3 px",
+            .height = font_8x5[0], .width = font_8x5[1], .spacing = font_8x5[2],
+            .first = (char) font_8x5[3], .last = (char) font_8x5[4],
+            .data = font_8x5 + 5,
+            .space_advance = 3,
+            .tabular_digits = 1,
+            .kerning = 1,
+        },
+        {
+            .name = "atlas_digits_16",
+            .comment = "digitos grandes, 16 linhas x 10 colunas, de '-' a ':'",
+            .height = BIG_H, .width = BIG_W, .spacing = 2,
+            .first = BIG_FIRST, .last = BIG_LAST,
+            .data = big_digits,
+            .space_advance = BIG_W + 2,
+            .tabular_digits = 1,
+            .kerning = 0,
+        },
+    };
+
+    printf("/*\n");
+    printf(" * Gerado por tools/gen_font_atlas.c a partir de ssd1306_font.h, nao editar.\n");
+    printf(" *\n");
+    printf(" * Desenhar com ssd1306_draw_string_with_atlas(&disp, x, y, escala, &atlas_8x5, texto).\n");
+    printf(" */\n\n");
+    printf("#ifndef _inc_font_atlas\n#define _inc_font_atlas\n\n");
+    printf("#include \"ssd1306.h\"\n\n");
+    for (size_t i = 0; i < sizeof fonts / sizeof fonts[0]; i++)
+        emit(&fonts[i]);
+    printf("#endif\n");
+    return 0;
+}
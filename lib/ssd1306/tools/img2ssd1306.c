@@ -0,0 +1,159 @@
+/*
+ * Conversor de imagens para ssd1306_image_t (ssd1306_draw_image).
+ *
+ * Le PBM (P1/P4) ou BMP monocromatico sem compressao e grava um header C
+ * com os bytes ja na ordem de paginas do display, comprimidos com RLE
+ * quando isso ocupa menos que a imagem crua.
+ *
+ * Compilar (a partir de lib/ssd1306):
+ *   gcc -std=c11 -O2 -Iinclude tools/img2ssd1306.c -o img2ssd1306
+ * Usar:
+ *   ./img2ssd1306 [-n nome] [-raw] logo.pbm > logo_image.h
+ */
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ssd1306_image_encode.h"
+
+#define MAX_W 128
+#define MAX_H 64
+
+static uint8_t pixels[MAX_W * MAX_H];
+static uint32_t width, height;
+
+static int pbm_int(FILE *f) {
+    int c, v = 0;
+    do {
+        c = fgetc(f);
+        if (c == '#')
+            while (c != '\n' && c != EOF)
+                c = fgetc(f);
+    } while (isspace(c));
+    if (!isdigit(c))
+        return -1;
+    for (; isdigit(c); c = fgetc(f))
+        v = v * 10 + (c - '0');
+    return v;
+}
+
+static int read_pbm(FILE *f, int ascii) {
+    const int w = pbm_int(f), h = pbm_int(f);
+    if (w <= 0 || h <= 0 || w > MAX_W || h > MAX_H)
+        return 0;
+    width = w;
+    height = h;
+
+    for (uint32_t y = 0; y < height; y++) {
+        if (ascii) {
+            for (uint32_t x = 0; x < width; x++) {
+                const int v = pbm_int(f);
+                if (v < 0)
+                    return 0;
+                pixels[y * width + x] = v != 0;
+            }
+        } else {
+            uint8_t row[MAX_W / 8];
+            if (fread(row, 1, (width + 7) / 8, f) != (width + 7) / 8)
+                return 0;
+            for (uint32_t x = 0; x < width; x++)
+                pixels[y * width + x] = (row[x >> 3] >> (7 - (x & 7))) & 1;
+        }
+    }
+    return 1;
+}
+
+static uint32_t le(const uint8_t *p, int n) {
+    uint32_t v = 0;
+    while (n--)
+        v = (v << 8) | p[n];
+    return v;
+}
+
+/* mesmo criterio de ssd1306_bmp_show_image_with_offset: a cor preta da paleta acende o pixel */
+static int read_bmp(FILE *f) {
+    static uint8_t file[64 * 1024];
+    const size_t size = fread(file, 1, sizeof file, f);
+    if (size < 62 || le(file + 28, 2) != 1 || le(file + 30, 4) != 0)
+        return 0;
+
+    const uint32_t off = le(file + 10, 4), dib = le(file + 14, 4);
+    const int32_t w = (int32_t) le(file + 18, 4), h = (int32_t) le(file + 22, 4);
+    const uint32_t ah = h < 0 ? -h : h;
+    if (w <= 0 || w > MAX_W || ah == 0 || ah > MAX_H)
+        return 0;
+
+    const uint8_t *palette = file + 14 + dib;
+    const uint8_t on = (palette[0] | palette[1] | palette[2]) == 0 ? 0 : 1;
+    const uint32_t stride = ((w + 31) / 32) * 4;
+    if (off + stride * ah > size)
+        return 0;
+
+    width = w;
+    height = ah;
+    for (uint32_t y = 0; y < height; y++) {
+        const uint8_t *row = file + off + stride * (h > 0 ? height - 1 - y : y);
+        for (uint32_t x = 0; x < width; x++)
+            pixels[y * width + x] = ((row[x >> 3] >> (7 - (x & 7))) & 1) == on;
+    }
+    return 1;
+}
+
+int main(int argc, char **argv) {
+    const char *name = "image", *path = NULL;
+    int force_raw = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc)
+            name = argv[++i];
+        else if (!strcmp(argv[i], "-raw"))
+            force_raw = 1;
+        else
+            path = argv[i];
+    }
+    if (!path) {
+        fprintf(stderr, "uso: %s [-n nome] [-raw] imagem.pbm|imagem.bmp > imagem.h\n", argv[0]);
+        return 2;
+    }
+
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return 1;
+    }
+    char magic[2] = {0};
+    int ok = 0;
+    if (fread(magic, 1, 2, f) == 2) {
+        if (magic[0] == 'P' && (magic[1] == '1' || magic[1] == '4'))
+            ok = read_pbm(f, magic[1] == '1');
+        else if (magic[0] == 'B' && magic[1] == 'M') {
+            rewind(f);
+            ok = read_bmp(f);
+        }
+    }
+    fclose(f);
+    if (!ok) {
+        fprintf(stderr, "%s: esperado PBM ou BMP de 1 bit, no maximo %dx%d\n", path, MAX_W, MAX_H);
+        return 1;
+    }
+
+    static uint8_t pages[MAX_W * MAX_H / 8], rle[SSD1306_IMAGE_RLE_MAX(MAX_W * MAX_H / 8)];
+    const size_t raw_len = (size_t)((height + 7) / 8) * width;
+    ssd1306_image_pack(pixels, width, height, pages);
+    const size_t rle_len = ssd1306_image_rle(pages, raw_len, rle);
+    const int use_rle = !force_raw && rle_len < raw_len;
+    const uint8_t *data = use_rle ? rle : pages;
+    const size_t len = use_rle ? rle_len : raw_len;
+
+    printf("/* gerado por tools/img2ssd1306.c a partir de %s, nao editar */\n", path);
+    printf("/* %ux%u, %zu bytes (%s; crua: %zu) */\n", width, height, len, use_rle ? "RLE" : "crua", raw_len);
+    printf("static const uint8_t %s_data[] = {", name);
+    for (size_t i = 0; i < len; i++)
+        printf("%s0x%02X,", i % 16 ? "" : "\n    ", data[i]);
+    printf("\n};\n\n");
+    printf("static const ssd1306_image_t %s = {\n", name);
+    printf("    %u, %u, %s, sizeof %s_data, %s_data\n", width, (height + 7) / 8,
+           use_rle ? "SSD1306_IMAGE_RLE" : "SSD1306_IMAGE_RAW", name, name);
+    printf("};\n");
+    return 0;
+}
@@ -0,0 +1,58 @@
+/*
+ * Codificacao de imagens no formato de ssd1306_image_t, usada pelo
+ * img2ssd1306 e pelos testes no PC. So roda no PC; no RP2040 fica apenas o
+ * decodificador (ssd1306_draw_image).
+ */
+#ifndef _tools_ssd1306_image_encode_h
+#define _tools_ssd1306_image_encode_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* maior saida possivel de ssd1306_image_rle para len bytes */
+#define SSD1306_IMAGE_RLE_MAX(len) ((len) + ((len) + 127) / 128)
+
+/* pixels em linhas (1 = aceso, um byte por pixel) para bytes de pagina do display */
+static inline void ssd1306_image_pack(const uint8_t *pixels, uint32_t width, uint32_t height, uint8_t *out) {
+    const uint32_t pages = (height + 7) / 8;
+    memset(out, 0, (size_t) pages * width);
+    for (uint32_t y = 0; y < height; y++)
+        for (uint32_t x = 0; x < width; x++)
+            if (pixels[y * width + x])
+                out[(y >> 3) * width + x] |= 1u << (y & 7);
+}
+
+/*
+ * c < 0x80: c+1 bytes literais seguem; c >= 0x80: o proximo byte repete c-0x7e vezes.
+ * Repeticoes de 3 ou mais viram corrida; de 2 so quando nao quebram um literal.
+ */
+static inline size_t ssd1306_image_rle(const uint8_t *src, size_t len, uint8_t *out) {
+    size_t o = 0, i = 0, lit = 0;   /* lit: inicio do literal aberto, em out */
+    size_t lit_len = 0;
+
+    while (i < len) {
+        size_t run = 1;
+        while (i + run < len && run < 129 && src[i + run] == src[i])
+            run++;
+
+        if (run >= 3 || (run == 2 && lit_len == 0)) {
+            out[o++] = (uint8_t)(0x7e + run);
+            out[o++] = src[i];
+            i += run;
+            lit_len = 0;
+            continue;
+        }
+
+        if (lit_len == 0) {
+            lit = o++;
+        }
+        out[o++] = src[i++];
+        out[lit] = (uint8_t)(lit_len++);
+        if (lit_len == 128)
+            lit_len = 0;
+    }
+    return o;
+}
+
+#endif
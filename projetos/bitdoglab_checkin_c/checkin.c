@@ -28,11 +28,16 @@
  #include "lwip/inet.h"
  #include "dhcpserver/dhcpserver.h"
  #include "dnsserver/dnsserver.h"
+ #include "http_server.h"     // Servidor HTTP/1.1: página, API JSON e eventos
+ #include "occupancy.h"       // Estado da ocupação e contador de versão
+ #include "pico/rand.h"
  
  // Drivers do display OLED – API baseada em ssd1306_t (BitDogLab)
  #include "ssd1306.h"       // Declarações, comandos e protótipos para o SSD1306
  #include "ssd1306_i2c.h"   // Implementação via I2C
  #include "ssd1306_font.h"  // Fonte utilizada pelo display
+ #include "ssd1306_font_atlas.h" // Fontes pré-decodificadas (proporcional e dígitos grandes)
+ #include "ssd1306_text_cache.h"     // Cache dos rótulos já renderizados
  
  #include <stdio.h>
  #include <string.h>
@@ -77,40 +82,21 @@
    #define CYW43_AUTH_WPA2_AES_PSK 4
  #endif
  
- // Configurações de ocupação
- #define NUM_FLOORS     5
- #define MAX_OCCUPANCY  50  // controle via botões/HTTP
- // Para a matriz: 50 pessoas = linha completa de 5 LEDs (cada LED equivale a 10 pessoas)
- 
  /* ─── VARIÁVEIS GLOBAIS ───────────────────────────────────────────── */
- static int occupancy[NUM_FLOORS] = {0, 0, 0, 0, 0};
- static int selected_floor = 0;
+ // occupancy[] e selected_floor estão em occupancy.c
  
  // Objeto global para o display OLED
  ssd1306_t disp;
+ // Buffers do OLED fora do heap, que fica para o lwIP (tamanho conferido na compilação)
+ SSD1306_STATIC_STORAGE(disp_mem, SSD1306_WIDTH, SSD1306_HEIGHT);
+ static ssd1306_text_cache_t text_cache;
  
  // Variáveis para a matriz de LED WS2812
  PIO pio_ws;
  uint sm_ws;
  uint offset_ws;
  
- /* ─── FUNÇÕES AUXILIARES PARA PARÂMETROS HTTP ──────────────────────────*/
- // Função genérica para extrair um parâmetro da query string
- static void parse_param(const char *request_line, const char *key, char *dest, size_t dest_size) {
-     dest[0] = '\0';
-     const char *p = strstr(request_line, key);
-     if (p) {
-         p += strlen(key);
-         size_t i = 0;
-         while (*p && *p != '&' && *p != ' ' && i < dest_size - 1) {
-             dest[i++] = *p++;
-         }
-         dest[i] = '\0';
-     }
- }
- 
  /* Protótipos */
- static void parse_query_params(const char *request_line, char *floor_str, size_t floor_len, char *action, size_t action_len, char *value_str, size_t value_len);
  void update_led_matrix(void);
  
  /* ─── FUNÇÕES AUXILIARES ───────────────────────────────────────────── */
@@ -123,9 +109,18 @@
      gpio_pull_up(I2C_SCL);
  
      disp.external_vcc = false;
-     if (!ssd1306_init(&disp, SSD1306_WIDTH, SSD1306_HEIGHT, SSD1306_I2C_ADDR, I2C_PORT)) {
+     if (!ssd1306_init_static(&disp, SSD1306_WIDTH, SSD1306_HEIGHT, SSD1306_I2C_ADDR, I2C_PORT,
+                              disp_mem.buffer, sizeof disp_mem.buffer)) {
           printf("Erro ao inicializar o OLED\n");
      }
+     // Quadros enviados por DMA para não travar o callback do lwIP por ~25 ms
+     if (!ssd1306_async_init_static(&disp, disp_mem.dma, sizeof disp_mem.dma)) {
+          printf("OLED sem DMA, usando envio bloqueante\n");
+     }
+     // Só os bytes que mudaram (ex.: o dígito da ocupação) são reenviados
+     if (!ssd1306_shadow_init_static(&disp, disp_mem.shadow, sizeof disp_mem.shadow)) {
+          printf("OLED sem copia do quadro, enviando janela inteira\n");
+     }
      ssd1306_clear(&disp);
  }
  
@@ -136,7 +131,7 @@
      }
      sleep_ms(50);
      ssd1306_draw_string(&disp, x, y, 1, str);
-     ssd1306_show(&disp);
+     ssd1306_show_async(&disp);
  }
  
  // Atualiza os LEDs RGB individuais conforme a ocupação do andar selecionado
@@ -153,14 +148,51 @@
  
  // Atualiza o display OLED com o status do andar selecionado
  void update_oled_display(void) {
+     static const char *const floor_label[NUM_FLOORS] = {
+          "Terreo: ", "Andar 1: ", "Andar 2: ", "Andar 3: ", "Andar 4: "
+     };
      char buf[64];
      ssd1306_clear(&disp);
-     if (selected_floor == 0)
-          snprintf(buf, sizeof(buf), "Terreo: %d pessoas", occupancy[selected_floor]);
-     else
-          snprintf(buf, sizeof(buf), "Andar %d: %d pessoas", selected_floor, occupancy[selected_floor]);
-     ssd1306_draw_string(&disp, 0, 0, 1, buf);
-     ssd1306_show(&disp);
+     // Rótulos do cache; só o número é renderizado de novo
+     uint32_t x = ssd1306_draw_cached_string_with_atlas(&disp, &text_cache, 0, 0, 1, &atlas_8x5, floor_label[selected_floor]);
+     snprintf(buf, sizeof(buf), "%d", occupancy[selected_floor]);
+     x = ssd1306_draw_string_with_atlas(&disp, x, 0, 1, &atlas_8x5, buf);
+     ssd1306_draw_cached_string_with_atlas(&disp, &text_cache, x, 0, 1, &atlas_8x5, " pessoas");
+     // Ocupação em dígitos grandes, centralizada abaixo do título
+     snprintf(buf, sizeof(buf), "%d/%d", occupancy[selected_floor], MAX_OCCUPANCY);
+     uint32_t w = ssd1306_string_width_with_atlas(&atlas_digits_16, 1, buf);
+     ssd1306_draw_string_with_atlas(&disp, (SSD1306_WIDTH - w) / 2, 24, 1, &atlas_digits_16, buf);
+     ssd1306_show_async(&disp);
+ }
+ 
+ /* ─── TAXA DE QUADROS DAS SAÍDAS ─────────────────────────────────── */
+ // Quem muda o estado (callback HTTP, botões) só marca as saídas como sujas;
+ // o loop principal atualiza LEDs, matriz e OLED no máximo OUTPUT_MAX_FPS vezes
+ // por segundo, então uma rajada de requisições vira um único quadro com o
+ // estado final. A matriz (25 pio_sm_put_blocking + 50 us de reset) e o OLED
+ // ficam fora do callback do lwIP, que roda numa IRQ com threadsafe_background.
+ #define OUTPUT_MAX_FPS   30
+ #define OUTPUT_FRAME_MS  (1000 / OUTPUT_MAX_FPS)
+ 
+ static volatile bool outputs_dirty = false;
+ static absolute_time_t outputs_next_frame;
+ 
+ // Pode ser chamada de qualquer contexto, inclusive do callback do lwIP
+ static inline void request_outputs_update(void) {
+     outputs_dirty = true;
+ }
+ 
+ // Chamada pelo loop principal: atualiza se houver mudança e o intervalo mínimo já passou
+ static void outputs_service(void) {
+     if (!outputs_dirty || absolute_time_diff_us(get_absolute_time(), outputs_next_frame) > 0)
+          return;
+     // Limpa antes de atualizar: mudanças durante o quadro pedem outro
+     outputs_dirty = false;
+     outputs_next_frame = make_timeout_time_ms(OUTPUT_FRAME_MS);
+     printf("Andar %d: ocupacao = %d\n", selected_floor, occupancy[selected_floor]);
+     update_led_status();
+     update_led_matrix();
+     update_oled_display();
  }
  
  // Lê o estado de um botão (com pull‑up: retorna 1 se pressionado)
@@ -168,198 +200,37 @@
      return (gpio_get(pin) == 0);
  }
  
+ // Seleciona o andar vizinho. Os callbacks do lwIP (numa IRQ com
+ // threadsafe_background) também mudam o estado e occupancy_version: sem a
+ // trava, um incremento deles no meio do nosso se perde e dois estados ficam
+ // com a mesma versão (página em cache e ETag velhas).
+ static void step_floor_selection(int step) {
+     cyw43_arch_lwip_begin();
+     occupancy_select((selected_floor + step + NUM_FLOORS) % NUM_FLOORS);
+     cyw43_arch_lwip_end();
+ }
+ 
  // Atualiza a seleção de andar via botões
  void update_floor_selection(void) {
      if (read_button(BUTTON_B)) {
-          selected_floor = (selected_floor + 1) % NUM_FLOORS;
-          update_oled_display();
-          update_led_status();
-          update_led_matrix();
+          step_floor_selection(1);
+          request_outputs_update();
           sleep_ms(300); // debounce
      }
      if (read_button(BUTTON_A)) {
-          selected_floor = (selected_floor - 1 + NUM_FLOORS) % NUM_FLOORS;
-          update_oled_display();
-          update_led_status();
-          update_led_matrix();
+          step_floor_selection(-1);
+          request_outputs_update();
           sleep_ms(300); // debounce
      }
  }
  
- // Atualiza a ocupação; suporta ações "add", "remove", "clear", "set" e "clear_all"
- // Quando a ação for "set", usa o valor passado em value_str.
- void update_occupancy(const char *floor_str, const char *action, const char *value_str) {
-     if (strcmp(action, "clear_all") == 0) {
-          for (int i = 0; i < NUM_FLOORS; i++) {
-               occupancy[i] = 0;
-          }
-     } else {
-          int floor = atoi(floor_str);
-          if (floor < 0 || floor >= NUM_FLOORS) return;
-          selected_floor = floor;
-          if (strcmp(action, "add") == 0) {
-               if (occupancy[floor] < MAX_OCCUPANCY)
-                    occupancy[floor]++;
-          } else if (strcmp(action, "remove") == 0) {
-               if (occupancy[floor] > 0)
-                    occupancy[floor]--;
-          } else if (strcmp(action, "clear") == 0) {
-               occupancy[floor] = 0;
-          } else if (strcmp(action, "set") == 0) {
-               occupancy[floor] = atoi(value_str);
-          }
-     }
-     printf("Andar %d: nova ocupacao = %d\n", selected_floor, occupancy[selected_floor]);
-     update_led_status();
-     update_oled_display();
-     update_led_matrix();
- }
- 
- /* Função para extrair parâmetros da query string.
-    Extrai os parâmetros "floor", "action" e "value". */
- static void parse_query_params(const char *request_line, char *floor_str, size_t floor_len,
-                                  char *action, size_t action_len, char *value_str, size_t value_len) {
-     parse_param(request_line, "floor=", floor_str, floor_len);
-     parse_param(request_line, "action=", action, action_len);
-     parse_param(request_line, "value=", value_str, value_len);
+ // Chamada no callback do lwIP depois que uma requisição mudou o estado
+ // (occupancy_apply/occupancy_select incrementam occupancy_version a cada mudança);
+ // LEDs, matriz e OLED são atualizados pelo loop principal
+ void update_outputs(void) {
+     request_outputs_update();
  }
  
- /* ─── GERA A PÁGINA HTML ───────────────────────────────────────────── */
- void create_html_page(char *buffer, size_t buffer_size) {
-     char body[2048] = "";
-     strcat(body, "<!DOCTYPE html><html><head><meta charset=\"UTF-8\"><title>Monitor de Ocupacao</title>");
-     strcat(body, "<style>table, th, td { border: 1px solid black; border-collapse: collapse; padding: 8px; }</style>");
-     strcat(body, "<meta http-equiv=\"Cache-Control\" content=\"no-store\"/>");
-     strcat(body, "</head><body>");
-     strcat(body, "<h1>Monitor de Ocupacao do Predio</h1>");
-     
-     // Formulário para modificar a ocupação
-     strcat(body, "<form action=\"/\" method=\"GET\">");
-     strcat(body, "<label for=\"floor\">Selecione o Andar:</label>");
-     strcat(body, "<select name=\"floor\" id=\"floor\">");
-     for (int i = 0; i < NUM_FLOORS; i++) {
-          char option[64];
-          if(i == 0)
-               snprintf(option, sizeof(option), "<option value=\"%d\" %s>Terreo</option>", i, (i==selected_floor) ? "selected" : "");
-          else
-               snprintf(option, sizeof(option), "<option value=\"%d\" %s>Andar %d</option>", i, (i==selected_floor) ? "selected" : "", i);
-          strcat(body, option);
-     }
-     strcat(body, "</select><br/><br/>");
-     strcat(body, "<input type=\"submit\" name=\"action\" value=\"add\"> ");
-     strcat(body, "<input type=\"submit\" name=\"action\" value=\"remove\"> ");
-     strcat(body, "<input type=\"submit\" name=\"action\" value=\"clear\"> ");
-     strcat(body, "<input type=\"submit\" name=\"action\" value=\"clear_all\"> <br/><br/>");
-     strcat(body, "Ou defina a ocupacao: <input type=\"text\" name=\"value\" placeholder=\"Numero\"> ");
-     strcat(body, "<input type=\"submit\" name=\"action\" value=\"set\">");
-     strcat(body, "</form>");
-     
-     // Tabela com o status de todos os andares
-     strcat(body, "<h2>Status dos Andares</h2>");
-     strcat(body, "<table>");
-     strcat(body, "<tr><th>Andar</th><th>Ocupacao</th></tr>");
-     for (int i = 0; i < NUM_FLOORS; i++) {
-          char row[128];
-          if (i == 0)
-               snprintf(row, sizeof(row), "<tr><td>Terreo</td><td>%d pessoas</td></tr>", occupancy[i]);
-          else
-               snprintf(row, sizeof(row), "<tr><td>Andar %d</td><td>%d pessoas</td></tr>", i, occupancy[i]);
-          strcat(body, row);
-     }
-     strcat(body, "</table>");
-     
-     strcat(body, "</body></html>");
-     
-     snprintf(buffer, buffer_size,
-              "HTTP/1.1 200 OK\r\nContent-Type: text/html; charset=UTF-8\r\nConnection: close\r\n\r\n%s",
-              body);
- }
- 
- /* ─── FUNÇÕES DO SERVIDOR HTTP ───────────────────────────────────────── */
- // Callback chamada após envio completo da resposta HTTP (fecha a conexão)
- static err_t sent_callback(void *arg, struct tcp_pcb *tpcb, u16_t len) {
-     printf("Resposta enviada, fechando conexao.\n");
-     tcp_arg(tpcb, NULL);
-     tcp_recv(tpcb, NULL);
-     tcp_sent(tpcb, NULL);
-     err_t err = tcp_close(tpcb);
-     if (err != ERR_OK) {
-          printf("Erro ao fechar conexao (err=%d), abortando.\n", err);
-          tcp_abort(tpcb);
-     }
-     return ERR_OK;
- }
-  
- // Callback HTTP: processa a requisição GET e atualiza a ocupação se os parâmetros estiverem presentes
- static err_t http_callback(void *arg, struct tcp_pcb *tpcb, struct pbuf *p, err_t err) {
-     if (p == NULL) {
-          tcp_close(tpcb);
-          return ERR_OK;
-     }
-     char request[1024] = {0};
-     size_t copy_len = (p->tot_len < sizeof(request)-1) ? p->tot_len : sizeof(request)-1;
-     memcpy(request, p->payload, copy_len);
-     request[copy_len] = '\0';
-     tcp_recved(tpcb, p->tot_len);
-  
-     char line[256] = {0};
-     char *token = strtok(request, "\r\n");
-     if (token) {
-          strncpy(line, token, sizeof(line)-1);
-     } else {
-          pbuf_free(p);
-          return ERR_OK;
-     }
-     if (strncmp(line, "GET", 3) != 0) {
-          pbuf_free(p);
-          return ERR_OK;
-     }
-    
-     char floor_str[8] = "";
-     char action[16] = "";
-     char value_str[8] = "";
-     parse_query_params(line, floor_str, sizeof(floor_str), action, sizeof(action), value_str, sizeof(value_str));
-     if (floor_str[0] != '\0' && strcmp(action, "clear_all") != 0) {
-          selected_floor = atoi(floor_str);
-     }
-     if (action[0] != '\0') {
-          update_occupancy(floor_str, action, value_str);
-     }
-    
-     char response[2048] = {0};
-     create_html_page(response, sizeof(response));
-     err_t write_err = tcp_write(tpcb, response, strlen(response), TCP_WRITE_FLAG_COPY);
-     if (write_err == ERR_OK) {
-          tcp_sent(tpcb, sent_callback);
-          tcp_output(tpcb);
-     } else {
-          printf("Erro ao escrever a resposta (err=%d), fechando conexao.\n", write_err);
-          tcp_close(tpcb);
-     }
-     pbuf_free(p);
-     return ERR_OK;
- }
-  
- static err_t connection_callback(void *arg, struct tcp_pcb *newpcb, err_t err) {
-     tcp_recv(newpcb, http_callback);
-     return ERR_OK;
- }
-  
- static void start_http_server(void) {
-     struct tcp_pcb *pcb = tcp_new_ip_type(IPADDR_TYPE_ANY);
-     if (!pcb) {
-          printf("Erro ao criar PCB\n");
-          return;
-     }
-     if (tcp_bind(pcb, IP_ANY_TYPE, HTTP_PORT) != ERR_OK) {
-          printf("Erro ao ligar o servidor na porta %d\n", HTTP_PORT);
-          return;
-     }
-     pcb = tcp_listen(pcb);
-     tcp_accept(pcb, connection_callback);
-     printf("Servidor HTTP rodando na porta %d...\n", HTTP_PORT);
- }
-  
  /* ─── FUNÇÕES PARA A MATRIZ DE LED WS2812 ───────────────────────────── */
  // Envia a cor para um LED WS2812 (dados no formato GRB, deslocados 8 bits à esquerda)
  static inline void put_pixel(PIO pio, uint sm, uint32_t pixel_grb) {
@@ -418,6 +289,8 @@ void update_led_matrix(void) {
      stdio_init_all();
      sleep_ms(10000);  // Aguarda 10s para estabilidade
      printf("Iniciando sistema!\n");
+     // Versão inicial aleatória: ETags de antes de reiniciar não valem mais
+     occupancy_init(get_rand_32());
   
      /* Inicializa o Wi‑Fi */
      if (cyw43_arch_init()) {
@@ -471,17 +344,18 @@ void update_led_matrix(void) {
      update_led_matrix();
   
      /* Inicia o servidor HTTP */
-     start_http_server();
+     http_server_start(HTTP_PORT, update_outputs);
   
-     /* Loop principal: Processa tarefas do Wi-Fi e atualiza a seleção via botões */
+     /* Loop principal: Processa tarefas do Wi-Fi, atualiza a seleção via botões e as saídas */
      while (true) {
           #if PICO_CYW43_ARCH_POLL
                cyw43_arch_poll();
-               cyw43_arch_wait_for_work_until(make_timeout_time_ms(100));
+               cyw43_arch_wait_for_work_until(make_timeout_time_ms(OUTPUT_FRAME_MS));
           #else
-               sleep_ms(100);
+               sleep_ms(OUTPUT_FRAME_MS);
           #endif
                update_floor_selection();
+               outputs_service();
           }
   
      cyw43_arch_deinit();
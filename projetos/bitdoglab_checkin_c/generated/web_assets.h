@@ -0,0 +1,440 @@
+/*
+ * Gerado por tools/gen_assets.c a partir de web/; não editar.
+ *
+ *   /            index.html   606 bytes, gzip   382
+ *   /app.css     app.css      311 bytes, gzip   215
+ *   /app.js      app.js      2937 bytes, gzip  1242
+ *   total                    3854 bytes, gzip  1839
+ */
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include "http_assets.h"
+
+static const char web_index_html_gzip_head[] =
+    "HTTP/1.1 200 OK\r\nContent-Type: text/html; charset=utf-8\r\nContent-Encoding: gzip\r\nVary: Accept-Encoding\r\nCache-Control: no-cache\r\nETag: \"2ac0fdac\"\r\nContent-Length: 382\r\n\r\n";
+static const char web_index_html_gzip_304[] =
+    "HTTP/1.1 304 Not Modified\r\nVary: Accept-Encoding\r\nCache-Control: no-cache\r\nETag: \"2ac0fdac\"\r\n\r\n";
+static const char web_index_html_gzip_etag[] = "\"2ac0fdac\"";
+static const char web_index_html_gzip_body[] =
+    "\x1f\x8b\x08\x00\x00\x00\x00\x00\x02\x03\x6d\x92\xbd\x6e\xdd\x30"
+    "\x0c\x85\xf7\x3c\x05\xab\x39\x8e\x90\x2d\x83\xac\xa2\x7f\x4b\x81"
+    "\x22\x41\xd2\x0e\xed\xc6\x2b\xd1\xb5\x5a\xd9\x12\x24\xfa\x06\x79"
+    "\x9c\xa0\x43\xd1\xe7\xb8\x2f\x56\xca\xf6\x0d\x50\xa0\x13\xa5\xc3"
+    "\x83\x8f\x47\x84\xcc\xab\xf7\xb7\xef\x3e\x7f\xbd\xfb\x00\x23\x4f"
+    "\xd1\x5e\x98\x56\x20\xe2\xfc\xbd\x57\x99\xbb\xb7\xf7\xaa\x69\x84"
+    "\x5e\xca\x44\x8c\xe0\x46\x2c\x95\xb8\x57\x0b\x0f\xdd\x8d\x3a\xcb"
+    "\x33\x4e\xd4\xab\x63\xa0\xc7\x9c\x0a\x2b\x70\x69\x66\x9a\xc5\xf6"
+    "\x18\x3c\x8f\xbd\xa7\x63\x70\xd4\xad\x97\x4b\x08\x73\xe0\x80\xb1"
+    "\xab\x0e\x23\xf5\xd7\x0d\xc2\x81\x23\xd9\x4f\x49\x3a\xa9\x80\x27"
+    "\xb8\x75\x4b\xc6\xd3\xef\xd3\xaf\x64\xf4\xd6\xbc\x30\x31\xcc\x3f"
+    "\xa1\x50\xec\x55\xe5\xa7\x48\x75\x24\x92\x51\x63\xa1\xa1\x57\x1a"
+    "\x73\xbe\x72\xb5\x36\x58\x75\x25\x64\x86\x5a\xdc\xae\xff\xa8\x4a"
+    "\x98\x03\x15\x6b\xf4\xd6\x14\x97\xde\x9f\x75\x48\xfe\xa9\x3d\xf2"
+    "\xfa\xff\xe3\xc1\x27\xb8\x2b\xa7\x3f\x3e\x48\x12\x31\x49\x56\x3c"
+    "\xac\x71\x78\x05\x18\x16\x2a\x8f\xf6\xcd\xec\xb1\x48\xd6\x71\xbd"
+    "\xfd\x13\x7f\x93\xb6\x83\x6e\x76\xcd\xfb\x6c\x6e\xc3\x21\xf8\x5e"
+    "\x0d\x31\xa5\x22\xe9\xa5\xb7\x07\xd2\xe7\x39\xd9\x9a\xc3\xc2\x9c"
+    "\xe6\xd5\xe8\x22\x61\xe9\x30\x46\x65\xbf\x51\xc1\x02\x9c\x7c\xaa"
+    "\x46\x6f\x16\x0b\xa6\x66\xdc\x9c\x95\x91\x97\x15\xd9\x24\x29\x59"
+    "\x60\x73\xda\x17\x20\xd8\x07\x9a\xe0\x23\x1e\xf1\x61\x55\x5e\xc3"
+    "\x97\x4a\x80\x60\xf0\xbc\xd2\x21\x95\x49\xd9\x23\x95\xda\xf6\x20"
+    "\xe6\x26\x2c\xf1\xf4\x5c\xda\x2e\xd0\x5e\x35\xa4\xd1\x2f\x48\xc9"
+    "\x7c\xce\xbe\xfd\xa6\xbf\x03\xfb\xb2\xa2\x5e\x02\x00\x00";
+
+static const char web_index_html_identity_head[] =
+    "HTTP/1.1 200 OK\r\nContent-Type: text/html; charset=utf-8\r\nVary: Accept-Encoding\r\nCache-Control: no-cache\r\nETag: \"504975a6\"\r\nContent-Length: 606\r\n\r\n";
+static const char web_index_html_identity_304[] =
+    "HTTP/1.1 304 Not Modified\r\nVary: Accept-Encoding\r\nCache-Control: no-cache\r\nETag: \"504975a6\"\r\n\r\n";
+static const char web_index_html_identity_etag[] = "\"504975a6\"";
+static const char web_index_html_identity_body[] =
+    "\x3c\x21\x44\x4f\x43\x54\x59\x50\x45\x20\x68\x74\x6d\x6c\x3e\x0a"
+    "\x3c\x68\x74\x6d\x6c\x20\x6c\x61\x6e\x67\x3d\x22\x70\x74\x2d\x42"
+    "\x52\x22\x3e\x0a\x3c\x68\x65\x61\x64\x3e\x0a\x3c\x6d\x65\x74\x61"
+    "\x20\x63\x68\x61\x72\x73\x65\x74\x3d\x22\x75\x74\x66\x2d\x38\x22"
+    "\x3e\x0a\x3c\x6d\x65\x74\x61\x20\x6e\x61\x6d\x65\x3d\x22\x76\x69"
+    "\x65\x77\x70\x6f\x72\x74\x22\x20\x63\x6f\x6e\x74\x65\x6e\x74\x3d"
+    "\x22\x77\x69\x64\x74\x68\x3d\x64\x65\x76\x69\x63\x65\x2d\x77\x69"
+    "\x64\x74\x68\x2c\x20\x69\x6e\x69\x74\x69\x61\x6c\x2d\x73\x63\x61"
+    "\x6c\x65\x3d\x31\x22\x3e\x0a\x3c\x74\x69\x74\x6c\x65\x3e\x4d\x6f"
+    "\x6e\x69\x74\x6f\x72\x20\x64\x65\x20\x4f\x63\x75\x70\x61\xc3\xa7"
+    "\xc3\xa3\x6f\x3c\x2f\x74\x69\x74\x6c\x65\x3e\x0a\x3c\x6c\x69\x6e"
+    "\x6b\x20\x72\x65\x6c\x3d\x22\x73\x74\x79\x6c\x65\x73\x68\x65\x65"
+    "\x74\x22\x20\x68\x72\x65\x66\x3d\x22\x2f\x61\x70\x70\x2e\x63\x73"
+    "\x73\x22\x3e\x0a\x3c\x73\x63\x72\x69\x70\x74\x20\x73\x72\x63\x3d"
+    "\x22\x2f\x61\x70\x70\x2e\x6a\x73\x22\x20\x64\x65\x66\x65\x72\x3e"
+    "\x3c\x2f\x73\x63\x72\x69\x70\x74\x3e\x0a\x3c\x2f\x68\x65\x61\x64"
+    "\x3e\x0a\x3c\x62\x6f\x64\x79\x3e\x0a\x3c\x68\x31\x3e\x4d\x6f\x6e"
+    "\x69\x74\x6f\x72\x20\x64\x65\x20\x4f\x63\x75\x70\x61\xc3\xa7\xc3"
+    "\xa3\x6f\x20\x64\x6f\x20\x50\x72\xc3\xa9\x64\x69\x6f\x3c\x2f\x68"
+    "\x31\x3e\x0a\x3c\x74\x61\x62\x6c\x65\x3e\x0a\x3c\x74\x68\x65\x61"
+    "\x64\x3e\x3c\x74\x72\x3e\x3c\x74\x68\x3e\x41\x6e\x64\x61\x72\x3c"
+    "\x2f\x74\x68\x3e\x3c\x74\x68\x3e\x4f\x63\x75\x70\x61\xc3\xa7\xc3"
+    "\xa3\x6f\x3c\x2f\x74\x68\x3e\x3c\x74\x68\x3e\x3c\x2f\x74\x68\x3e"
+    "\x3c\x2f\x74\x72\x3e\x3c\x2f\x74\x68\x65\x61\x64\x3e\x0a\x3c\x74"
+    "\x62\x6f\x64\x79\x20\x69\x64\x3d\x22\x66\x6c\x6f\x6f\x72\x73\x22"
+    "\x3e\x3c\x2f\x74\x62\x6f\x64\x79\x3e\x0a\x3c\x2f\x74\x61\x62\x6c"
+    "\x65\x3e\x0a\x3c\x70\x3e\x3c\x62\x75\x74\x74\x6f\x6e\x20\x69\x64"
+    "\x3d\x22\x63\x6c\x65\x61\x72\x2d\x61\x6c\x6c\x22\x3e\x5a\x65\x72"
+    "\x61\x72\x20\x74\x6f\x64\x6f\x73\x3c\x2f\x62\x75\x74\x74\x6f\x6e"
+    "\x3e\x20\x3c\x73\x70\x61\x6e\x20\x69\x64\x3d\x22\x73\x74\x61\x74"
+    "\x75\x73\x22\x3e\x3c\x2f\x73\x70\x61\x6e\x3e\x3c\x2f\x70\x3e\x0a"
+    "\x3c\x6e\x6f\x73\x63\x72\x69\x70\x74\x3e\x3c\x70\x3e\x53\x65\x6d"
+    "\x20\x4a\x61\x76\x61\x53\x63\x72\x69\x70\x74\x3f\x20\x55\x73\x65"
+    "\x20\x61\x20\x3c\x61\x20\x68\x72\x65\x66\x3d\x22\x2f\x66\x6f\x72"
+    "\x6d\x22\x3e\x76\x65\x72\x73\xc3\xa3\x6f\x20\x65\x6d\x20\x66\x6f"
+    "\x72\x6d\x75\x6c\xc3\xa1\x72\x69\x6f\x3c\x2f\x61\x3e\x2e\x3c\x2f"
+    "\x70\x3e\x3c\x2f\x6e\x6f\x73\x63\x72\x69\x70\x74\x3e\x0a\x3c\x2f"
+    "\x62\x6f\x64\x79\x3e\x0a\x3c\x2f\x68\x74\x6d\x6c\x3e\x0a";
+
+static const char web_app_css_gzip_head[] =
+    "HTTP/1.1 200 OK\r\nContent-Type: text/css; charset=utf-8\r\nContent-Encoding: gzip\r\nVary: Accept-Encoding\r\nCache-Control: no-cache\r\nETag: \"2568c216\"\r\nContent-Length: 215\r\n\r\n";
+static const char web_app_css_gzip_304[] =
+    "HTTP/1.1 304 Not Modified\r\nVary: Accept-Encoding\r\nCache-Control: no-cache\r\nETag: \"2568c216\"\r\n\r\n";
+static const char web_app_css_gzip_etag[] = "\"2568c216\"";
+static const char web_app_css_gzip_body[] =
+    "\x1f\x8b\x08\x00\x00\x00\x00\x00\x02\x03\x4d\x8f\xc1\x8a\xc3\x30"
+    "\x0c\x44\xef\xfb\x15\x82\x5e\xeb\xd0\x76\x97\xb0\x38\x5f\x23\xc7"
+    "\x4e\x22\x56\xb1\x8d\x2d\xd3\x94\xd2\x7f\x5f\xa7\x69\x4b\x6e\x42"
+    "\x9a\x37\x33\x32\xc1\xde\xe0\x0e\x43\xf0\xa2\x06\x9c\x89\x6f\x1a"
+    "\x32\xfa\xac\xb2\x4b\x34\x74\x30\x63\x1a\xc9\x6b\x38\xbb\xb9\x83"
+    "\xc7\x97\xa0\x61\x57\xf5\x26\x24\xeb\x92\xea\x03\x33\xc6\xec\x34"
+    "\xbc\xa7\xa7\x68\x3a\x82\xd8\x8f\xaa\xc2\x71\x81\x1c\x98\x2c\x18"
+    "\xc6\xfe\xaf\x83\x88\xd6\x92\x1f\x35\xfc\xc6\xe5\x49\xd8\xa6\x0f"
+    "\xc5\x4b\x65\xc4\x2d\xa2\x90\x69\xac\xa1\x89\xc6\x49\x6a\x07\xf2"
+    "\xea\x4a\x56\x26\x0d\xdf\xaf\x1a\xa9\x19\x0a\x33\xec\xb8\x5a\x20"
+    "\xd4\xa8\x83\x39\x9d\xba\xed\x9d\xab\x5b\x71\x5d\x5b\xb0\x5d\x21"
+    "\xf2\xb1\xac\xca\x97\xd5\xcf\x66\x65\x8a\x48\xf0\x75\xbd\x4b\xb9"
+    "\x34\x97\xed\x78\xc8\x82\x52\xf2\xce\xbe\x6d\xdb\xf5\xf0\x0f\x8e"
+    "\xbf\x44\x5b\x37\x01\x00\x00";
+
+static const char web_app_css_identity_head[] =
+    "HTTP/1.1 200 OK\r\nContent-Type: text/css; charset=utf-8\r\nVary: Accept-Encoding\r\nCache-Control: no-cache\r\nETag: \"45953f3b\"\r\nContent-Length: 311\r\n\r\n";
+static const char web_app_css_identity_304[] =
+    "HTTP/1.1 304 Not Modified\r\nVary: Accept-Encoding\r\nCache-Control: no-cache\r\nETag: \"45953f3b\"\r\n\r\n";
+static const char web_app_css_identity_etag[] = "\"45953f3b\"";
+static const char web_app_css_identity_body[] =
+    "\x62\x6f\x64\x79\x20\x7b\x20\x66\x6f\x6e\x74\x2d\x66\x61\x6d\x69"
+    "\x6c\x79\x3a\x20\x73\x61\x6e\x73\x2d\x73\x65\x72\x69\x66\x3b\x20"
+    "\x6d\x61\x72\x67\x69\x6e\x3a\x20\x31\x65\x6d\x3b\x20\x7d\x0a\x74"
+    "\x61\x62\x6c\x65\x20\x7b\x20\x62\x6f\x72\x64\x65\x72\x2d\x63\x6f"
+    "\x6c\x6c\x61\x70\x73\x65\x3a\x20\x63\x6f\x6c\x6c\x61\x70\x73\x65"
+    "\x3b\x20\x7d\x0a\x74\x68\x2c\x20\x74\x64\x20\x7b\x20\x62\x6f\x72"
+    "\x64\x65\x72\x3a\x20\x31\x70\x78\x20\x73\x6f\x6c\x69\x64\x20\x62"
+    "\x6c\x61\x63\x6b\x3b\x20\x70\x61\x64\x64\x69\x6e\x67\x3a\x20\x38"
+    "\x70\x78\x3b\x20\x7d\x0a\x74\x64\x2e\x63\x6f\x75\x6e\x74\x20\x7b"
+    "\x20\x74\x65\x78\x74\x2d\x61\x6c\x69\x67\x6e\x3a\x20\x72\x69\x67"
+    "\x68\x74\x3b\x20\x6d\x69\x6e\x2d\x77\x69\x64\x74\x68\x3a\x20\x33"
+    "\x65\x6d\x3b\x20\x7d\x0a\x74\x72\x2e\x66\x75\x6c\x6c\x20\x74\x64"
+    "\x2e\x63\x6f\x75\x6e\x74\x20\x7b\x20\x63\x6f\x6c\x6f\x72\x3a\x20"
+    "\x23\x62\x30\x30\x3b\x20\x66\x6f\x6e\x74\x2d\x77\x65\x69\x67\x68"
+    "\x74\x3a\x20\x62\x6f\x6c\x64\x3b\x20\x7d\x0a\x69\x6e\x70\x75\x74"
+    "\x20\x7b\x20\x77\x69\x64\x74\x68\x3a\x20\x34\x65\x6d\x3b\x20\x7d"
+    "\x0a\x62\x75\x74\x74\x6f\x6e\x20\x7b\x20\x6d\x69\x6e\x2d\x77\x69"
+    "\x64\x74\x68\x3a\x20\x32\x2e\x32\x65\x6d\x3b\x20\x7d\x0a\x23\x73"
+    "\x74\x61\x74\x75\x73\x20\x7b\x20\x63\x6f\x6c\x6f\x72\x3a\x20\x23"
+    "\x36\x36\x36\x3b\x20\x7d\x0a";
+
+static const char web_app_js_gzip_head[] =
+    "HTTP/1.1 200 OK\r\nContent-Type: text/javascript; charset=utf-8\r\nContent-Encoding: gzip\r\nVary: Accept-Encoding\r\nCache-Control: no-cache\r\nETag: \"afd566f3\"\r\nContent-Length: 1242\r\n\r\n";
+static const char web_app_js_gzip_304[] =
+    "HTTP/1.1 304 Not Modified\r\nVary: Accept-Encoding\r\nCache-Control: no-cache\r\nETag: \"afd566f3\"\r\n\r\n";
+static const char web_app_js_gzip_etag[] = "\"afd566f3\"";
+static const char web_app_js_gzip_body[] =
+    "\x1f\x8b\x08\x00\x00\x00\x00\x00\x02\x03\x85\x56\xc1\x8e\xdb\x36"
+    "\x10\xbd\xfb\x2b\xa6\x27\x49\x58\x57\x36\x52\xe4\x62\xd7\x2d\xd2"
+    "\xed\x1e\x52\x6c\xb3\x41\xbc\x39\x05\x45\x41\x4b\x63\x9b\x8d\x44"
+    "\xba\x24\xe5\xcd\xc2\xf1\xbd\xe7\xfe\x41\xd1\x43\xd1\x73\xd1\x4b"
+    "\xaf\xfe\x93\x7e\x49\x67\x48\xca\x96\xed\x78\x1b\x60\x63\x69\x38"
+    "\x7c\xf3\x34\x7c\x33\xc3\xc1\x00\xbe\xd7\x4a\x3a\x6d\xa0\x44\xd0"
+    "\x45\xb3\x12\xbb\x3f\x76\xbf\xeb\x11\x68\x40\xeb\x44\xa9\x61\x8d"
+    "\x35\xaf\x0d\xc4\x4a\x0e\xe6\x95\xd6\xc6\x02\xbd\xe1\x1a\x95\xb3"
+    "\x90\x7e\x37\xbd\x7b\x95\xf5\x7b\x83\x01\x08\x0b\xa2\x72\x68\x18"
+    "\xe0\x6f\xb4\xb0\x26\x18\x58\x11\xf0\xeb\xbb\xe9\x3d\xac\x84\x11"
+    "\x5d\x8c\xc1\x46\x6d\xf3\x5e\xd2\x58\x04\xeb\x8c\x2c\x5c\x32\xee"
+    "\xf5\xd6\xc2\x80\xd1\x0f\x16\x26\xf0\xee\x87\xb1\x7f\xad\xc5\x07"
+    "\x7a\x7b\x3e\x0c\x6f\xc4\xc8\x35\xf6\x1e\x3f\x38\x32\x96\x44\xb7"
+    "\x26\x16\xf9\x02\xdd\x4d\x85\xfc\xf8\xcd\xe3\xcb\x32\x4d\x82\x57"
+    "\x92\x11\xe2\xbc\x51\x85\x93\x5a\x81\x8f\xfa\x4a\xd4\x98\xca\x0c"
+    "\x36\x3d\x00\x83\xae\x31\x0a\x24\x7c\x0d\xc9\x0b\x55\x12\x78\x02"
+    "\x57\xf4\x3a\x82\xe4\x7e\xf7\xa7\x31\xa8\x89\xd1\xb6\x83\x60\x97"
+    "\xfa\x21\xf5\x30\x7d\x28\x74\xa3\x5c\xc0\x89\x9c\x89\x0f\x33\x7f"
+    "\xe7\x1d\x88\x3b\x80\x9c\x43\xfa\x19\xd9\xb2\x18\x8a\x6d\xf4\x9a"
+    "\xfb\xbd\xb9\xa3\x6f\xb8\xd6\xca\x11\x69\xda\xea\x6d\xad\x83\x33"
+    "\x79\x51\x09\x6b\x99\x6d\xbb\x06\x5f\x4d\x7c\x2a\x88\xec\xbc\xa9"
+    "\xaa\x84\x69\x9e\xf0\x9b\x35\xce\x69\x95\x56\x62\x86\x55\x1f\x84"
+    "\x37\xf6\xc3\x77\x1f\x98\xce\xba\x79\x2b\x0c\x0a\x87\x31\x75\x69"
+    "\x12\x00\x38\x6d\x00\xb3\x13\x82\x1e\x35\x2c\x68\x55\x54\xb2\x78"
+    "\x4f\xc6\x7d\xe8\x94\x02\xd0\x51\x5b\xd7\xe6\x27\x44\xcf\xc6\xb0"
+    "\x1d\x1f\x52\x3d\xf3\x7c\x49\x29\x6f\x6b\x01\x95\x54\x4b\xe1\xe5"
+    "\x21\x38\xf9\x94\x52\x23\x45\x29\x40\x91\xd1\xc8\x1a\x25\xc9\xc5"
+    "\xa0\x65\x50\x31\x26\xfd\xad\xb4\xb4\x60\x77\x7f\x91\x2e\xd5\xee"
+    "\x9f\x1a\x8d\x86\xba\x29\x45\xf7\xf3\x65\x55\xa6\xaa\xf3\xa9\xba"
+    "\x7c\x7c\x4a\x25\x41\x87\xe1\x73\xe7\xc4\x23\xe5\x4d\x32\x9e\x63"
+    "\x5e\xa1\x5a\xb8\xe5\x98\x0c\x5f\x82\xa2\x9f\xab\xab\x80\x1c\xb0"
+    "\x9d\x21\x3f\x0e\x90\x4b\x65\xd1\xb8\x37\x24\x0d\x0f\x04\xb4\x14"
+    "\x6d\xd7\x58\x55\x69\x76\x92\xc7\xae\x0c\xc7\x7b\xb8\x70\xc4\x93"
+    "\xd3\xbd\xc1\x21\xe8\xa5\xab\x88\xc4\x9b\x92\xce\x7e\x72\xbf\xb4"
+    "\x9d\xd7\xd7\xa2\x6a\xf0\x89\x93\x97\x6a\xd5\xb8\x64\xbf\x81\x9c"
+    "\x73\xf7\xb8\xf2\xa1\x54\x53\xcf\xd0\x24\xdd\xa5\x5a\x2a\x5a\x19"
+    "\x76\x4d\xab\x4a\x14\xb8\xd4\x55\x89\x9c\x98\xe4\x55\xf4\x67\x5e"
+    "\xb9\x58\xad\x50\x95\x69\x94\x67\x72\x95\xf4\x21\x11\x65\x49\x3f"
+    "\x32\xa3\x47\xa0\x87\x76\xed\xdf\x5f\x7e\xe5\x55\x83\xb5\x5e\x63"
+    "\xc7\xc1\x83\x75\xff\xb5\x1b\x86\xec\x5e\x54\x28\x4c\x17\xce\x73"
+    "\x3a\xa0\x96\x38\x97\x4a\xb2\x47\x62\xd1\x79\xc7\xf8\xa9\xfe\xa4"
+    "\x57\x8d\x5d\xa6\x1b\x4a\xde\x88\xfe\x62\x69\x8f\xc2\x4f\x84\x1a"
+    "\xc5\x04\x6e\xfd\xb6\xed\x59\x57\x78\x41\xd9\xe6\x9e\x83\x41\x22"
+    "\xa1\x65\x79\x43\xce\xcf\x1f\x3f\xb2\xc9\x17\x8f\xd7\x68\x58\x09"
+    "\xf2\x8b\x3a\xf3\xc0\x47\x76\x52\xe4\x8d\x28\x96\xe9\xa1\xc6\x22"
+    "\x23\x6e\x5f\xa1\x17\xc9\xb6\x0f\x8d\x3d\xb3\x2e\x2b\x83\x3f\x37"
+    "\xd4\xbe\xd3\xc6\x50\x2b\x60\x9d\x1e\xca\x82\x52\xe1\xa2\x78\xa9"
+    "\x9b\x6c\xa0\x46\xb7\xd4\x25\xb5\x13\x6e\xd3\x49\xf0\x1e\x81\xc2"
+    "\x07\x78\xfb\xe6\x76\x4a\x99\x2d\x96\xaf\xa9\x77\xd7\x36\x0d\x38"
+    "\x5b\x6a\x3d\x9b\x6e\x59\xcf\xd1\x11\x4f\x1f\x89\xb1\x49\xf1\x4b"
+    "\x54\x1d\xde\xa6\x2d\x9c\xe8\x6f\xf2\x9f\x2c\x1d\xcb\x99\x1f\x5b"
+    "\x5b\xd7\xb6\x7b\xe6\xfa\x7d\x06\x6e\xc9\xfd\x95\x19\xdd\x18\xa3"
+    "\x8d\x77\xcc\x91\x1f\x39\xb5\x26\x0f\xed\x3e\x1e\x29\x74\x66\xc4"
+    "\x49\xed\x25\x49\xeb\x12\x99\x30\x50\x30\xc5\x93\xcd\xf2\x42\xb8"
+    "\xa3\xa4\x63\xcb\xe8\x32\x2a\x93\x1a\xf9\xe1\x41\xc7\x8d\xd6\x8a"
+    "\x05\xc6\x4e\xe0\x79\x63\x40\x3e\x3e\x9f\x4f\xf4\xca\xd3\xbe\xb5"
+    "\x89\x0b\xa3\xf8\x1b\x5a\x29\xa7\x25\xbe\x4f\x26\x93\x20\xe8\x2c"
+    "\x74\xa2\xb6\xc8\x3b\x63\x28\xd8\xc2\xff\xe1\xc4\x82\x2c\x92\xee"
+    "\x20\x66\xe6\x91\x8a\x3f\xe1\xd3\x73\x99\xef\x05\x37\xcf\xa3\xdf"
+    "\x3c\xdf\x0b\xaf\x7f\x3c\x05\xce\x85\x38\xa7\x2e\xbe\x4c\xdb\x99"
+    "\x7b\x1e\x3f\x89\x01\x63\x21\x7d\x1a\xef\x62\x13\xf7\xb5\xff\xb9"
+    "\xa0\x89\x98\x5d\x1a\x4c\x97\xe2\xf6\x3b\x29\x0e\x38\x3f\x32\x0e"
+    "\xab\xe0\xff\x08\x8d\xfd\x18\xbb\xe1\x2b\x90\xb6\xa3\xf6\xa2\x54"
+    "\xe8\x7a\x55\xa1\xd3\x20\xf8\x59\x61\xe1\x78\xae\xc5\xd1\xd5\xd4"
+    "\x61\xd0\xf9\x91\x47\xfc\x59\x26\x75\x0e\x53\xac\x19\x6a\x2d\x16"
+    "\x02\xe8\x9e\xb5\xbf\x56\x3d\x1f\x7e\x41\xdd\x8c\x66\x9d\x58\xe3"
+    "\x82\xc0\xf9\x7a\x66\xa5\x75\x48\x77\x2f\x9a\x90\xbb\xdf\x16\x92"
+    "\x26\x25\x45\xb1\x4d\xe5\x04\x99\x0a\x1e\x9e\xcf\xc0\xe6\xbd\x7d"
+    "\xca\xc7\x3d\x56\xcb\x83\x54\x25\x5d\x2a\x3c\xd9\xa9\x6e\x4c\x81"
+    "\x07\xa9\xc5\x68\x93\x50\x5c\x07\x0f\x4a\x54\x58\x0a\x33\x21\x3c"
+    "\xe7\xd4\xb4\xbd\xcf\x2d\xf3\x50\x68\xf6\x23\xb4\x9b\x22\x6c\xd5"
+    "\xc2\x4d\x91\x2f\x87\x39\xdd\xfc\x2c\xa6\x98\x97\xc2\x89\x2c\xf6"
+    "\xaa\x3d\xa6\x56\xb1\x64\x8e\x4e\x0d\xbb\xb3\x76\x4e\x4b\xe7\x40"
+    "\xa1\xc4\x2e\xc8\x92\x2b\xee\x28\x48\xe8\x16\xe7\xc2\x08\x05\x15"
+    "\xdd\x68\x26\x96\x8f\x53\x6e\xc2\xbe\xb6\x3a\xf9\xc8\xaf\x6f\xef"
+    "\xa6\x37\xdf\x66\x40\xe5\xf6\x92\x0a\xdf\x50\x45\xa5\x31\xcf\x7d"
+    "\x78\x36\x1c\x0e\xdb\x98\x5b\xc0\x8a\xae\xb4\x8c\xfd\x94\xef\xb6"
+    "\xf7\x1f\xd5\x06\xe3\xd3\x79\x0b\x00\x00";
+
+static const char web_app_js_identity_head[] =
+    "HTTP/1.1 200 OK\r\nContent-Type: text/javascript; charset=utf-8\r\nVary: Accept-Encoding\r\nCache-Control: no-cache\r\nETag: \"78f152cd\"\r\nContent-Length: 2937\r\n\r\n";
+static const char web_app_js_identity_304[] =
+    "HTTP/1.1 304 Not Modified\r\nVary: Accept-Encoding\r\nCache-Control: no-cache\r\nETag: \"78f152cd\"\r\n\r\n";
+static const char web_app_js_identity_etag[] = "\"78f152cd\"";
+static const char web_app_js_identity_body[] =
+    "\x2f\x2f\x20\x4d\x6f\x6e\x69\x74\x6f\x72\x20\x64\x65\x20\x6f\x63"
+    "\x75\x70\x61\xc3\xa7\xc3\xa3\x6f\x3a\x20\x6f\x20\x65\x73\x74\x61"
+    "\x64\x6f\x20\x76\x65\x6d\x20\x64\x65\x20\x2f\x61\x70\x69\x2f\x66"
+    "\x6c\x6f\x6f\x72\x73\x20\x65\x20\x2f\x65\x76\x65\x6e\x74\x73\x20"
+    "\x28\x4a\x53\x4f\x4e\x29\x2c\x0a\x2f\x2f\x20\x61\x73\x20\x61\x6c"
+    "\x74\x65\x72\x61\xc3\xa7\xc3\xb5\x65\x73\x20\x76\xc3\xa3\x6f\x20"
+    "\x70\x6f\x72\x20\x50\x4f\x53\x54\x20\x70\x61\x72\x61\x20\x2f\x61"
+    "\x70\x69\x2f\x66\x6c\x6f\x6f\x72\x73\x2f\x7b\x6e\x7d\x2e\x0a\x27"
+    "\x75\x73\x65\x20\x73\x74\x72\x69\x63\x74\x27\x3b\x0a\x0a\x76\x61"
+    "\x72\x20\x72\x6f\x77\x73\x20\x3d\x20\x5b\x5d\x3b\x0a\x76\x61\x72"
+    "\x20\x6d\x61\x78\x20\x3d\x20\x35\x30\x3b\x0a\x76\x61\x72\x20\x73"
+    "\x74\x61\x74\x75\x73\x54\x65\x78\x74\x20\x3d\x20\x64\x6f\x63\x75"
+    "\x6d\x65\x6e\x74\x2e\x67\x65\x74\x45\x6c\x65\x6d\x65\x6e\x74\x42"
+    "\x79\x49\x64\x28\x27\x73\x74\x61\x74\x75\x73\x27\x29\x3b\x0a\x0a"
+    "\x66\x75\x6e\x63\x74\x69\x6f\x6e\x20\x66\x6c\x6f\x6f\x72\x4e\x61"
+    "\x6d\x65\x28\x69\x29\x20\x7b\x0a\x20\x20\x72\x65\x74\x75\x72\x6e"
+    "\x20\x69\x20\x3f\x20\x27\x41\x6e\x64\x61\x72\x20\x27\x20\x2b\x20"
+    "\x69\x20\x3a\x20\x27\x54\xc3\xa9\x72\x72\x65\x6f\x27\x3b\x0a\x7d"
+    "\x0a\x0a\x66\x75\x6e\x63\x74\x69\x6f\x6e\x20\x73\x68\x6f\x77\x28"
+    "\x66\x6c\x6f\x6f\x72\x2c\x20\x63\x6f\x75\x6e\x74\x29\x20\x7b\x0a"
+    "\x20\x20\x76\x61\x72\x20\x72\x6f\x77\x20\x3d\x20\x72\x6f\x77\x73"
+    "\x5b\x66\x6c\x6f\x6f\x72\x5d\x3b\x0a\x20\x20\x69\x66\x20\x28\x21"
+    "\x72\x6f\x77\x29\x20\x72\x65\x74\x75\x72\x6e\x3b\x0a\x20\x20\x72"
+    "\x6f\x77\x2e\x63\x6f\x75\x6e\x74\x2e\x74\x65\x78\x74\x43\x6f\x6e"
+    "\x74\x65\x6e\x74\x20\x3d\x20\x63\x6f\x75\x6e\x74\x3b\x0a\x20\x20"
+    "\x72\x6f\x77\x2e\x74\x72\x2e\x63\x6c\x61\x73\x73\x4e\x61\x6d\x65"
+    "\x20\x3d\x20\x63\x6f\x75\x6e\x74\x20\x3e\x3d\x20\x6d\x61\x78\x20"
+    "\x3f\x20\x27\x66\x75\x6c\x6c\x27\x20\x3a\x20\x27\x27\x3b\x0a\x7d"
+    "\x0a\x0a\x66\x75\x6e\x63\x74\x69\x6f\x6e\x20\x62\x75\x74\x74\x6f"
+    "\x6e\x28\x6c\x61\x62\x65\x6c\x2c\x20\x61\x63\x74\x69\x6f\x6e\x2c"
+    "\x20\x66\x6c\x6f\x6f\x72\x29\x20\x7b\x0a\x20\x20\x76\x61\x72\x20"
+    "\x62\x20\x3d\x20\x64\x6f\x63\x75\x6d\x65\x6e\x74\x2e\x63\x72\x65"
+    "\x61\x74\x65\x45\x6c\x65\x6d\x65\x6e\x74\x28\x27\x62\x75\x74\x74"
+    "\x6f\x6e\x27\x29\x3b\x0a\x20\x20\x62\x2e\x74\x65\x78\x74\x43\x6f"
+    "\x6e\x74\x65\x6e\x74\x20\x3d\x20\x6c\x61\x62\x65\x6c\x3b\x0a\x20"
+    "\x20\x62\x2e\x6f\x6e\x63\x6c\x69\x63\x6b\x20\x3d\x20\x66\x75\x6e"
+    "\x63\x74\x69\x6f\x6e\x20\x28\x29\x20\x7b\x20\x70\x6f\x73\x74\x28"
+    "\x66\x6c\x6f\x6f\x72\x2c\x20\x61\x63\x74\x69\x6f\x6e\x29\x3b\x20"
+    "\x7d\x3b\x0a\x20\x20\x72\x65\x74\x75\x72\x6e\x20\x62\x3b\x0a\x7d"
+    "\x0a\x0a\x2f\x2f\x20\x55\x6d\x61\x20\x6c\x69\x6e\x68\x61\x20\x70"
+    "\x6f\x72\x20\x61\x6e\x64\x61\x72\x2c\x20\x63\x72\x69\x61\x64\x61"
+    "\x20\x6e\x61\x20\x70\x72\x69\x6d\x65\x69\x72\x61\x20\x72\x65\x73"
+    "\x70\x6f\x73\x74\x61\x3b\x20\x64\x65\x70\x6f\x69\x73\x20\x73\xc3"
+    "\xb3\x20\x6f\x20\x6e\xc3\xba\x6d\x65\x72\x6f\x20\x6d\x75\x64\x61"
+    "\x0a\x66\x75\x6e\x63\x74\x69\x6f\x6e\x20\x62\x75\x69\x6c\x64\x28"
+    "\x6e\x29\x20\x7b\x0a\x20\x20\x76\x61\x72\x20\x62\x6f\x64\x79\x20"
+    "\x3d\x20\x64\x6f\x63\x75\x6d\x65\x6e\x74\x2e\x67\x65\x74\x45\x6c"
+    "\x65\x6d\x65\x6e\x74\x42\x79\x49\x64\x28\x27\x66\x6c\x6f\x6f\x72"
+    "\x73\x27\x29\x3b\x0a\x20\x20\x66\x6f\x72\x20\x28\x76\x61\x72\x20"
+    "\x69\x20\x3d\x20\x72\x6f\x77\x73\x2e\x6c\x65\x6e\x67\x74\x68\x3b"
+    "\x20\x69\x20\x3c\x20\x6e\x3b\x20\x69\x2b\x2b\x29\x20\x7b\x0a\x20"
+    "\x20\x20\x20\x76\x61\x72\x20\x74\x72\x20\x3d\x20\x62\x6f\x64\x79"
+    "\x2e\x69\x6e\x73\x65\x72\x74\x52\x6f\x77\x28\x29\x3b\x0a\x20\x20"
+    "\x20\x20\x74\x72\x2e\x69\x6e\x73\x65\x72\x74\x43\x65\x6c\x6c\x28"
+    "\x29\x2e\x74\x65\x78\x74\x43\x6f\x6e\x74\x65\x6e\x74\x20\x3d\x20"
+    "\x66\x6c\x6f\x6f\x72\x4e\x61\x6d\x65\x28\x69\x29\x3b\x0a\x20\x20"
+    "\x20\x20\x76\x61\x72\x20\x63\x6f\x75\x6e\x74\x20\x3d\x20\x74\x72"
+    "\x2e\x69\x6e\x73\x65\x72\x74\x43\x65\x6c\x6c\x28\x29\x3b\x0a\x20"
+    "\x20\x20\x20\x63\x6f\x75\x6e\x74\x2e\x63\x6c\x61\x73\x73\x4e\x61"
+    "\x6d\x65\x20\x3d\x20\x27\x63\x6f\x75\x6e\x74\x27\x3b\x0a\x20\x20"
+    "\x20\x20\x76\x61\x72\x20\x63\x65\x6c\x6c\x20\x3d\x20\x74\x72\x2e"
+    "\x69\x6e\x73\x65\x72\x74\x43\x65\x6c\x6c\x28\x29\x3b\x0a\x20\x20"
+    "\x20\x20\x76\x61\x72\x20\x76\x61\x6c\x75\x65\x20\x3d\x20\x64\x6f"
+    "\x63\x75\x6d\x65\x6e\x74\x2e\x63\x72\x65\x61\x74\x65\x45\x6c\x65"
+    "\x6d\x65\x6e\x74\x28\x27\x69\x6e\x70\x75\x74\x27\x29\x3b\x0a\x20"
+    "\x20\x20\x20\x76\x61\x6c\x75\x65\x2e\x74\x79\x70\x65\x20\x3d\x20"
+    "\x27\x6e\x75\x6d\x62\x65\x72\x27\x3b\x0a\x20\x20\x20\x20\x76\x61"
+    "\x6c\x75\x65\x2e\x6d\x69\x6e\x20\x3d\x20\x30\x3b\x0a\x20\x20\x20"
+    "\x20\x76\x61\x6c\x75\x65\x2e\x70\x6c\x61\x63\x65\x68\x6f\x6c\x64"
+    "\x65\x72\x20\x3d\x20\x27\x4e\x27\x3b\x0a\x20\x20\x20\x20\x63\x65"
+    "\x6c\x6c\x2e\x61\x70\x70\x65\x6e\x64\x28\x62\x75\x74\x74\x6f\x6e"
+    "\x28\x27\x2b\x27\x2c\x20\x27\x61\x64\x64\x27\x2c\x20\x69\x29\x2c"
+    "\x20\x27\x20\x27\x2c\x20\x62\x75\x74\x74\x6f\x6e\x28\x27\xe2\x88"
+    "\x92\x27\x2c\x20\x27\x72\x65\x6d\x6f\x76\x65\x27\x2c\x20\x69\x29"
+    "\x2c\x20\x27\x20\x27\x2c\x0a\x20\x20\x20\x20\x20\x20\x20\x20\x20"
+    "\x20\x20\x20\x20\x20\x20\x20\x62\x75\x74\x74\x6f\x6e\x28\x27\x30"
+    "\x27\x2c\x20\x27\x63\x6c\x65\x61\x72\x27\x2c\x20\x69\x29\x2c\x20"
+    "\x27\x20\x27\x2c\x20\x76\x61\x6c\x75\x65\x2c\x20\x62\x75\x74\x74"
+    "\x6f\x6e\x28\x27\x64\x65\x66\x69\x6e\x69\x72\x27\x2c\x20\x27\x73"
+    "\x65\x74\x27\x2c\x20\x69\x29\x29\x3b\x0a\x20\x20\x20\x20\x72\x6f"
+    "\x77\x73\x2e\x70\x75\x73\x68\x28\x7b\x20\x74\x72\x3a\x20\x74\x72"
+    "\x2c\x20\x63\x6f\x75\x6e\x74\x3a\x20\x63\x6f\x75\x6e\x74\x2c\x20"
+    "\x76\x61\x6c\x75\x65\x3a\x20\x76\x61\x6c\x75\x65\x20\x7d\x29\x3b"
+    "\x0a\x20\x20\x7d\x0a\x7d\x0a\x0a\x66\x75\x6e\x63\x74\x69\x6f\x6e"
+    "\x20\x73\x68\x6f\x77\x41\x6c\x6c\x28\x73\x74\x61\x74\x65\x29\x20"
+    "\x7b\x0a\x20\x20\x6d\x61\x78\x20\x3d\x20\x73\x74\x61\x74\x65\x2e"
+    "\x6d\x61\x78\x20\x7c\x7c\x20\x6d\x61\x78\x3b\x0a\x20\x20\x62\x75"
+    "\x69\x6c\x64\x28\x73\x74\x61\x74\x65\x2e\x66\x6c\x6f\x6f\x72\x73"
+    "\x2e\x6c\x65\x6e\x67\x74\x68\x29\x3b\x0a\x20\x20\x73\x74\x61\x74"
+    "\x65\x2e\x66\x6c\x6f\x6f\x72\x73\x2e\x66\x6f\x72\x45\x61\x63\x68"
+    "\x28\x66\x75\x6e\x63\x74\x69\x6f\x6e\x20\x28\x63\x6f\x75\x6e\x74"
+    "\x2c\x20\x69\x29\x20\x7b\x20\x73\x68\x6f\x77\x28\x69\x2c\x20\x63"
+    "\x6f\x75\x6e\x74\x29\x3b\x20\x7d\x29\x3b\x0a\x7d\x0a\x0a\x66\x75"
+    "\x6e\x63\x74\x69\x6f\x6e\x20\x72\x65\x71\x75\x65\x73\x74\x28\x75"
+    "\x72\x6c\x2c\x20\x62\x6f\x64\x79\x29\x20\x7b\x0a\x20\x20\x76\x61"
+    "\x72\x20\x69\x6e\x69\x74\x20\x3d\x20\x62\x6f\x64\x79\x20\x3f\x20"
+    "\x7b\x20\x6d\x65\x74\x68\x6f\x64\x3a\x20\x27\x50\x4f\x53\x54\x27"
+    "\x2c\x20\x62\x6f\x64\x79\x3a\x20\x6e\x65\x77\x20\x55\x52\x4c\x53"
+    "\x65\x61\x72\x63\x68\x50\x61\x72\x61\x6d\x73\x28\x62\x6f\x64\x79"
+    "\x29\x20\x7d\x20\x3a\x20\x7b\x7d\x3b\x0a\x20\x20\x72\x65\x74\x75"
+    "\x72\x6e\x20\x66\x65\x74\x63\x68\x28\x75\x72\x6c\x2c\x20\x69\x6e"
+    "\x69\x74\x29\x2e\x74\x68\x65\x6e\x28\x66\x75\x6e\x63\x74\x69\x6f"
+    "\x6e\x20\x28\x72\x29\x20\x7b\x0a\x20\x20\x20\x20\x72\x65\x74\x75"
+    "\x72\x6e\x20\x72\x2e\x6a\x73\x6f\x6e\x28\x29\x2e\x74\x68\x65\x6e"
+    "\x28\x66\x75\x6e\x63\x74\x69\x6f\x6e\x20\x28\x6a\x73\x6f\x6e\x29"
+    "\x20\x7b\x0a\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x72\x2e"
+    "\x6f\x6b\x29\x20\x74\x68\x72\x6f\x77\x20\x6e\x65\x77\x20\x45\x72"
+    "\x72\x6f\x72\x28\x6a\x73\x6f\x6e\x2e\x65\x72\x72\x6f\x72\x20\x7c"
+    "\x7c\x20\x72\x2e\x73\x74\x61\x74\x75\x73\x29\x3b\x0a\x20\x20\x20"
+    "\x20\x20\x20\x73\x74\x61\x74\x75\x73\x54\x65\x78\x74\x2e\x74\x65"
+    "\x78\x74\x43\x6f\x6e\x74\x65\x6e\x74\x20\x3d\x20\x27\x27\x3b\x0a"
+    "\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6e\x20\x6a\x73\x6f"
+    "\x6e\x3b\x0a\x20\x20\x20\x20\x7d\x29\x3b\x0a\x20\x20\x7d\x29\x2e"
+    "\x63\x61\x74\x63\x68\x28\x66\x75\x6e\x63\x74\x69\x6f\x6e\x20\x28"
+    "\x65\x29\x20\x7b\x0a\x20\x20\x20\x20\x73\x74\x61\x74\x75\x73\x54"
+    "\x65\x78\x74\x2e\x74\x65\x78\x74\x43\x6f\x6e\x74\x65\x6e\x74\x20"
+    "\x3d\x20\x27\x45\x72\x72\x6f\x3a\x20\x27\x20\x2b\x20\x65\x2e\x6d"
+    "\x65\x73\x73\x61\x67\x65\x3b\x0a\x20\x20\x20\x20\x74\x68\x72\x6f"
+    "\x77\x20\x65\x3b\x0a\x20\x20\x7d\x29\x3b\x0a\x7d\x0a\x0a\x66\x75"
+    "\x6e\x63\x74\x69\x6f\x6e\x20\x70\x6f\x73\x74\x28\x66\x6c\x6f\x6f"
+    "\x72\x2c\x20\x61\x63\x74\x69\x6f\x6e\x29\x20\x7b\x0a\x20\x20\x76"
+    "\x61\x72\x20\x62\x6f\x64\x79\x20\x3d\x20\x7b\x20\x61\x63\x74\x69"
+    "\x6f\x6e\x3a\x20\x61\x63\x74\x69\x6f\x6e\x20\x7d\x3b\x0a\x20\x20"
+    "\x69\x66\x20\x28\x61\x63\x74\x69\x6f\x6e\x20\x3d\x3d\x3d\x20\x27"
+    "\x73\x65\x74\x27\x29\x20\x62\x6f\x64\x79\x2e\x76\x61\x6c\x75\x65"
+    "\x20\x3d\x20\x72\x6f\x77\x73\x5b\x66\x6c\x6f\x6f\x72\x5d\x2e\x76"
+    "\x61\x6c\x75\x65\x2e\x76\x61\x6c\x75\x65\x3b\x0a\x20\x20\x72\x65"
+    "\x71\x75\x65\x73\x74\x28\x27\x2f\x61\x70\x69\x2f\x66\x6c\x6f\x6f"
+    "\x72\x73\x2f\x27\x20\x2b\x20\x66\x6c\x6f\x6f\x72\x2c\x20\x62\x6f"
+    "\x64\x79\x29\x2e\x74\x68\x65\x6e\x28\x66\x75\x6e\x63\x74\x69\x6f"
+    "\x6e\x20\x28\x66\x29\x20\x7b\x20\x73\x68\x6f\x77\x28\x66\x2e\x66"
+    "\x6c\x6f\x6f\x72\x2c\x20\x66\x2e\x63\x6f\x75\x6e\x74\x29\x3b\x20"
+    "\x7d\x2c\x20\x66\x75\x6e\x63\x74\x69\x6f\x6e\x20\x28\x29\x20\x7b"
+    "\x7d\x29\x3b\x0a\x7d\x0a\x0a\x66\x75\x6e\x63\x74\x69\x6f\x6e\x20"
+    "\x72\x65\x66\x72\x65\x73\x68\x28\x29\x20\x7b\x0a\x20\x20\x72\x65"
+    "\x71\x75\x65\x73\x74\x28\x27\x2f\x61\x70\x69\x2f\x66\x6c\x6f\x6f"
+    "\x72\x73\x27\x29\x2e\x74\x68\x65\x6e\x28\x73\x68\x6f\x77\x41\x6c"
+    "\x6c\x2c\x20\x66\x75\x6e\x63\x74\x69\x6f\x6e\x20\x28\x29\x20\x7b"
+    "\x7d\x29\x3b\x0a\x7d\x0a\x0a\x64\x6f\x63\x75\x6d\x65\x6e\x74\x2e"
+    "\x67\x65\x74\x45\x6c\x65\x6d\x65\x6e\x74\x42\x79\x49\x64\x28\x27"
+    "\x63\x6c\x65\x61\x72\x2d\x61\x6c\x6c\x27\x29\x2e\x6f\x6e\x63\x6c"
+    "\x69\x63\x6b\x20\x3d\x20\x66\x75\x6e\x63\x74\x69\x6f\x6e\x20\x28"
+    "\x29\x20\x7b\x0a\x20\x20\x72\x65\x71\x75\x65\x73\x74\x28\x27\x2f"
+    "\x61\x70\x69\x2f\x66\x6c\x6f\x6f\x72\x73\x27\x2c\x20\x7b\x20\x61"
+    "\x63\x74\x69\x6f\x6e\x3a\x20\x27\x63\x6c\x65\x61\x72\x5f\x61\x6c"
+    "\x6c\x27\x20\x7d\x29\x2e\x74\x68\x65\x6e\x28\x73\x68\x6f\x77\x41"
+    "\x6c\x6c\x2c\x20\x66\x75\x6e\x63\x74\x69\x6f\x6e\x20\x28\x29\x20"
+    "\x7b\x7d\x29\x3b\x0a\x7d\x3b\x0a\x0a\x2f\x2f\x20\x45\x76\x65\x6e"
+    "\x74\x6f\x73\x3a\x20\x65\x73\x74\x61\x64\x6f\x20\x63\x6f\x6d\x70"
+    "\x6c\x65\x74\x6f\x20\x61\x6f\x20\x63\x6f\x6e\x65\x63\x74\x61\x72"
+    "\x2c\x20\x64\x65\x70\x6f\x69\x73\x20\x75\x6d\x20\x61\x6e\x64\x61"
+    "\x72\x20\x70\x6f\x72\x20\x6d\x65\x6e\x73\x61\x67\x65\x6d\x2e\x20"
+    "\x53\x65\x6d\x0a\x2f\x2f\x20\x76\x61\x67\x61\x20\x65\x6d\x20\x2f"
+    "\x65\x76\x65\x6e\x74\x73\x20\x28\x35\x30\x33\x29\x2c\x20\x6f\x20"
+    "\x6e\x61\x76\x65\x67\x61\x64\x6f\x72\x20\x64\x65\x73\x69\x73\x74"
+    "\x65\x20\x65\x20\x61\x20\x70\xc3\xa1\x67\x69\x6e\x61\x20\x63\x6f"
+    "\x6e\x73\x75\x6c\x74\x61\x20\x61\x20\x63\x61\x64\x61\x20\x32\x20"
+    "\x73\x2e\x0a\x72\x65\x66\x72\x65\x73\x68\x28\x29\x3b\x0a\x69\x66"
+    "\x20\x28\x77\x69\x6e\x64\x6f\x77\x2e\x45\x76\x65\x6e\x74\x53\x6f"
+    "\x75\x72\x63\x65\x29\x20\x7b\x0a\x20\x20\x76\x61\x72\x20\x65\x76"
+    "\x65\x6e\x74\x73\x20\x3d\x20\x6e\x65\x77\x20\x45\x76\x65\x6e\x74"
+    "\x53\x6f\x75\x72\x63\x65\x28\x27\x2f\x65\x76\x65\x6e\x74\x73\x27"
+    "\x29\x3b\x0a\x20\x20\x65\x76\x65\x6e\x74\x73\x2e\x61\x64\x64\x45"
+    "\x76\x65\x6e\x74\x4c\x69\x73\x74\x65\x6e\x65\x72\x28\x27\x66\x6c"
+    "\x6f\x6f\x72\x73\x27\x2c\x20\x66\x75\x6e\x63\x74\x69\x6f\x6e\x20"
+    "\x28\x65\x29\x20\x7b\x20\x73\x68\x6f\x77\x41\x6c\x6c\x28\x4a\x53"
+    "\x4f\x4e\x2e\x70\x61\x72\x73\x65\x28\x65\x2e\x64\x61\x74\x61\x29"
+    "\x29\x3b\x20\x7d\x29\x3b\x0a\x20\x20\x65\x76\x65\x6e\x74\x73\x2e"
+    "\x6f\x6e\x6d\x65\x73\x73\x61\x67\x65\x20\x3d\x20\x66\x75\x6e\x63"
+    "\x74\x69\x6f\x6e\x20\x28\x65\x29\x20\x7b\x0a\x20\x20\x20\x20\x76"
+    "\x61\x72\x20\x66\x20\x3d\x20\x4a\x53\x4f\x4e\x2e\x70\x61\x72\x73"
+    "\x65\x28\x65\x2e\x64\x61\x74\x61\x29\x3b\x0a\x20\x20\x20\x20\x73"
+    "\x68\x6f\x77\x28\x66\x2e\x66\x6c\x6f\x6f\x72\x2c\x20\x66\x2e\x63"
+    "\x6f\x75\x6e\x74\x29\x3b\x0a\x20\x20\x7d\x3b\x0a\x20\x20\x65\x76"
+    "\x65\x6e\x74\x73\x2e\x6f\x6e\x65\x72\x72\x6f\x72\x20\x3d\x20\x66"
+    "\x75\x6e\x63\x74\x69\x6f\x6e\x20\x28\x29\x20\x7b\x0a\x20\x20\x20"
+    "\x20\x69\x66\x20\x28\x65\x76\x65\x6e\x74\x73\x2e\x72\x65\x61\x64"
+    "\x79\x53\x74\x61\x74\x65\x20\x3d\x3d\x3d\x20\x45\x76\x65\x6e\x74"
+    "\x53\x6f\x75\x72\x63\x65\x2e\x43\x4c\x4f\x53\x45\x44\x29\x20\x73"
+    "\x65\x74\x49\x6e\x74\x65\x72\x76\x61\x6c\x28\x72\x65\x66\x72\x65"
+    "\x73\x68\x2c\x20\x32\x30\x30\x30\x29\x3b\x0a\x20\x20\x7d\x3b\x0a"
+    "\x7d\x20\x65\x6c\x73\x65\x20\x7b\x0a\x20\x20\x73\x65\x74\x49\x6e"
+    "\x74\x65\x72\x76\x61\x6c\x28\x72\x65\x66\x72\x65\x73\x68\x2c\x20"
+    "\x32\x30\x30\x30\x29\x3b\x0a\x7d\x0a";
+
+// Maior resposta 200 (cabeçalho + corpo) entre todas as variantes
+#define WEB_ASSETS_RESPONSE_MAX 3090
+
+#define WEB_ASSETS_COUNT 3
+
+static const http_asset_t web_assets[WEB_ASSETS_COUNT] = {
+    { "/",
+        { web_index_html_gzip_head, web_index_html_gzip_body, web_index_html_gzip_304, web_index_html_gzip_etag,
+          sizeof(web_index_html_gzip_head) - 1, sizeof(web_index_html_gzip_body) - 1, sizeof(web_index_html_gzip_304) - 1 },
+        { web_index_html_identity_head, web_index_html_identity_body, web_index_html_identity_304, web_index_html_identity_etag,
+          sizeof(web_index_html_identity_head) - 1, sizeof(web_index_html_identity_body) - 1, sizeof(web_index_html_identity_304) - 1 },
+    },
+    { "/app.css",
+        { web_app_css_gzip_head, web_app_css_gzip_body, web_app_css_gzip_304, web_app_css_gzip_etag,
+          sizeof(web_app_css_gzip_head) - 1, sizeof(web_app_css_gzip_body) - 1, sizeof(web_app_css_gzip_304) - 1 },
+        { web_app_css_identity_head, web_app_css_identity_body, web_app_css_identity_304, web_app_css_identity_etag,
+          sizeof(web_app_css_identity_head) - 1, sizeof(web_app_css_identity_body) - 1, sizeof(web_app_css_identity_304) - 1 },
+    },
+    { "/app.js",
+        { web_app_js_gzip_head, web_app_js_gzip_body, web_app_js_gzip_304, web_app_js_gzip_etag,
+          sizeof(web_app_js_gzip_head) - 1, sizeof(web_app_js_gzip_body) - 1, sizeof(web_app_js_gzip_304) - 1 },
+        { web_app_js_identity_head, web_app_js_identity_body, web_app_js_identity_304, web_app_js_identity_etag,
+          sizeof(web_app_js_identity_head) - 1, sizeof(web_app_js_identity_body) - 1, sizeof(web_app_js_identity_304) - 1 },
+    },
+};
+
+#endif
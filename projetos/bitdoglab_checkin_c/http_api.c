@@ -0,0 +1,221 @@
+/**
+ * API REST em JSON para a ocupação (ver http_api.h).
+ */
+#include "http_api.h"
+#include "occupancy.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define API_PREFIX  "/api/floors"
+
+/* ─── STATUS E CABEÇALHOS FIXOS (FLASH) ────────────────────────────── */
+#define API_HEADERS "Content-Type: application/json\r\nCache-Control: no-store\r\n" \
+                    "Access-Control-Allow-Origin: *\r\n"
+
+static const char api_200[] = "HTTP/1.1 200 OK\r\n" API_HEADERS;
+static const char api_400[] = "HTTP/1.1 400 Bad Request\r\n" API_HEADERS;
+static const char api_404[] = "HTTP/1.1 404 Not Found\r\n" API_HEADERS;
+static const char api_405[] = "HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, POST\r\n" API_HEADERS;
+static const char api_405_post[] = "HTTP/1.1 405 Method Not Allowed\r\nAllow: POST\r\n" API_HEADERS;
+
+/* ─── CORPO JSON ───────────────────────────────────────────────────── */
+void http_api_put_floors(http_writer_t *w) {
+    http_put_str(w, "{\"version\":");
+    http_put_uint(w, occupancy_version);
+    http_put_str(w, ",\"selected\":");
+    http_put_int(w, selected_floor);
+    http_put_str(w, ",\"max\":");
+    http_put_int(w, MAX_OCCUPANCY);
+    http_put_str(w, ",\"floors\":[");
+    for (int i = 0; i < NUM_FLOORS; i++) {
+        if (i)
+            http_put_str(w, ",");
+        http_put_int(w, occupancy[i]);
+    }
+    http_put_str(w, "]}");
+}
+
+void http_api_put_floor(http_writer_t *w, int floor) {
+    http_put_str(w, "{\"floor\":");
+    http_put_int(w, floor);
+    http_put_str(w, ",\"count\":");
+    http_put_int(w, occupancy[floor]);
+    http_put_str(w, "}");
+}
+
+static void put_error(http_writer_t *w, const char *what) {
+    http_put_str(w, "{\"error\":\"");
+    http_put_str(w, what);
+    http_put_str(w, "\"}");
+}
+
+/* ─── CORPO DO POST ────────────────────────────────────────────────── */
+// Só dígitos, e poucos o bastante para caber num int
+static bool is_count(const char *s) {
+    size_t n = strlen(s);
+    if (n == 0 || n > 9)
+        return false;
+    for (; *s; s++)
+        if (*s < '0' || *s > '9')
+            return false;
+    return true;
+}
+
+/* ─── RESPOSTA ─────────────────────────────────────────────────────── */
+// Escreve o JSON em w e retorna o status (texto fixo)
+typedef const char *(*api_body_fn)(const http_request_t *req, int floor, http_writer_t *w);
+
+static void api_respond(http_response_t *res, const http_request_t *req, int floor, api_body_fn body) {
+    http_writer_t w;
+    http_writer_init(&w, res->buf, sizeof(res->buf));
+
+    // Corpo primeiro, Content-Length depois, no mesmo buffer: uma passada só
+    const char *json = w.pos;
+    const char *status = body(req, floor, &w);
+    size_t json_len = (size_t)(w.pos - json);
+
+    const char *length = w.pos;
+    http_put_str(&w, "Content-Length: ");
+    http_put_uint(&w, (uint32_t)json_len);
+    http_put_str(&w, "\r\n\r\n");
+    if (w.overflow) {
+        res->count = 0;
+        return;
+    }
+
+    http_segment_set(&res->local[0], status, strlen(status), false);
+    http_segment_set(&res->local[1], length, (size_t)(w.pos - length), true);
+    http_segment_set(&res->local[2], json, json_len, true);
+    res->seg = res->local;
+    res->count = HTTP_API_SEGMENTS;
+}
+
+/* ─── ROTAS ────────────────────────────────────────────────────────── */
+bool http_api_match(const char *path) {
+    size_t n = sizeof(API_PREFIX) - 1;
+    return strncmp(path, API_PREFIX, n) == 0 && (path[n] == '\0' || path[n] == '/' || path[n] == '?');
+}
+
+// floor: andar de /api/floors/{n}, ou -1 para /api/floors
+static const char *get_body(const http_request_t *req, int floor, http_writer_t *w) {
+    (void)req;
+    if (floor >= NUM_FLOORS) {
+        put_error(w, "floor");
+        return api_404;
+    }
+    if (floor < 0)
+        http_api_put_floors(w);
+    else
+        http_api_put_floor(w, floor);
+    return api_200;
+}
+
+static const char *post_body(const http_request_t *req, int floor, http_writer_t *w) {
+    if (floor >= NUM_FLOORS) {
+        put_error(w, "floor");
+        return api_404;
+    }
+    // parâmetros do corpo, já decodificados pelo http_parser
+    const char *token = http_param(req, "action");
+    const char *value = http_param(req, "value");
+    occupancy_action_t action = token ? occupancy_action(token) : OCCUPANCY_INVALID;
+    // sem andar na URL só vale clear_all; com andar, clear_all não vale
+    bool all = action == OCCUPANCY_CLEAR_ALL;
+    if (all != (floor < 0) || (action == OCCUPANCY_SET && !(value && is_count(value))) ||
+        !occupancy_do(action, floor, action == OCCUPANCY_SET ? atoi(value) : 0)) {
+        put_error(w, "action");
+        return api_400;
+    }
+    return get_body(req, floor, w);
+}
+
+/* Uma mudança do lote: chave "dN" (delta) ou "sN" (valor) para o andar N.
+   O andar é conferido por occupancy_batch. */
+static bool batch_change(const char *key, const char *value, occupancy_change_t *c) {
+    if ((key[0] != 'd' && key[0] != 's') || !is_count(key + 1))
+        return false;
+    c->absolute = key[0] == 's';
+    c->floor = atoi(key + 1);
+    // delta pode ser negativo; valor absoluto, não
+    bool negative = !c->absolute && value[0] == '-';
+    if (!is_count(value + negative))
+        return false;
+    c->value = negative ? -atoi(value + 1) : atoi(value);
+    return true;
+}
+
+static const char *batch_body(const http_request_t *req, int floor, http_writer_t *w) {
+    (void)floor;
+    occupancy_change_t changes[HTTP_API_BATCH_MAX];
+    size_t count = 0;
+    // pares "chave\0valor\0" do corpo, na ordem em que vieram
+    const char *key = req->params;
+    for (uint8_t i = 0; i < req->param_count; i++) {
+        const char *value = key + strlen(key) + 1;
+        if (count == HTTP_API_BATCH_MAX || !batch_change(key, value, &changes[count])) {
+            put_error(w, "batch");
+            return api_400;
+        }
+        count++;
+        key = value + strlen(value) + 1;
+    }
+    if (!count || !occupancy_batch(changes, count)) {
+        put_error(w, "batch");
+        return api_400;
+    }
+    http_api_put_floors(w);
+    return api_200;
+}
+
+static const char *not_allowed_body(const http_request_t *req, int floor, http_writer_t *w) {
+    (void)req;
+    (void)floor;
+    put_error(w, "method");
+    return api_405;
+}
+
+// /api/floors/batch só aceita POST
+static const char *batch_not_allowed_body(const http_request_t *req, int floor, http_writer_t *w) {
+    (void)req;
+    (void)floor;
+    put_error(w, "method");
+    return api_405_post;
+}
+
+static const char *not_found_body(const http_request_t *req, int floor, http_writer_t *w) {
+    (void)req;
+    (void)floor;
+    put_error(w, "floor");
+    return api_404;
+}
+
+void http_api_get(const http_request_t *req, int id, void *conn, http_response_t *res) {
+    (void)conn;
+    api_respond(res, req, id, get_body);
+}
+
+void http_api_post(const http_request_t *req, int id, void *conn, http_response_t *res) {
+    (void)conn;
+    api_respond(res, req, id, post_body);
+}
+
+void http_api_batch(const http_request_t *req, int id, void *conn, http_response_t *res) {
+    (void)conn;
+    api_respond(res, req, id, batch_body);
+}
+
+void http_api_not_allowed(const http_request_t *req, int id, void *conn, http_response_t *res) {
+    (void)conn;
+    api_respond(res, req, id, not_allowed_body);
+}
+
+void http_api_batch_not_allowed(const http_request_t *req, int id, void *conn, http_response_t *res) {
+    (void)conn;
+    api_respond(res, req, id, batch_not_allowed_body);
+}
+
+void http_api_not_found(const http_request_t *req, int id, void *conn, http_response_t *res) {
+    (void)conn;
+    api_respond(res, req, id, not_found_body);
+}
@@ -0,0 +1,67 @@
+/**
+ * API REST em JSON para a ocupação, ao lado do formulário HTML.
+ *
+ *   GET  /api/floors       {"version":N,"selected":S,"max":50,"floors":[a,b,c,d,e]}
+ *   GET  /api/floors/{n}   {"floor":n,"count":c}
+ *   POST /api/floors/{n}   corpo "action=add|remove|clear" ou "action=set&value=N";
+ *                          responde como o GET do andar, já atualizado
+ *   POST /api/floors       corpo "action=clear_all"; responde como GET /api/floors
+ *   POST /api/floors/batch corpo "d2=3&d0=-1&s4=10": lote de mudanças, "dN" soma
+ *                          ao andar N (como add/remove repetidos) e "sN" define;
+ *                          aplicado em ordem e de uma vez (tudo ou nada, uma
+ *                          atualização de LEDs e OLED); responde como GET /api/floors
+ *
+ * Erros: 400 (ação, valor ou lote inválido), 404 (caminho ou andar inexistente),
+ * 405 (método). O corpo é escrito numa passada só, no buffer da resposta, e
+ * sai em 3 segmentos: status e cabeçalhos fixos (flash), Content-Length e o
+ * JSON.
+ *
+ * As rotas entram na tabela do servidor com HTTP_API_ROUTES (http_router.h).
+ */
+#ifndef HTTP_API_H
+#define HTTP_API_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "http_router.h"
+#include "http_writer.h"
+
+#define HTTP_API_SEGMENTS 3
+
+/* Maior mudança útil nos parâmetros do http_parser: "dN\0" e um valor de até
+   3 caracteres ("-50", "50": a ocupação vai só até MAX_OCCUPANCY) e '\0' */
+#define HTTP_API_BATCH_PAIR 7
+/* Mudanças num lote. Uma a mais ainda cabe nos parâmetros, para o lote grande
+   demais receber o 400 "batch" e não o 413 do parser. */
+#define HTTP_API_BATCH_MAX (HTTP_PARSER_PARAMS_MAX / HTTP_API_BATCH_PAIR - 1)
+_Static_assert((HTTP_API_BATCH_MAX + 1) * HTTP_API_BATCH_PAIR <= HTTP_PARSER_PARAMS_MAX, "HTTP_API_BATCH_MAX");
+_Static_assert(HTTP_API_SEGMENTS <= HTTP_RESPONSE_SEGMENTS, "resposta da API nao cabe em http_response_t");
+
+// Objetos JSON das respostas, usados também pelos eventos (http_events.c)
+void http_api_put_floors(http_writer_t *w);          // {"version":..,"floors":[..]}
+void http_api_put_floor(http_writer_t *w, int floor); // {"floor":n,"count":c}
+
+// true se o caminho (com ou sem query) é da API
+bool http_api_match(const char *path);
+
+/* Handlers (http_handler_fn). id é o andar de /api/floors/{n} ou -1 para
+   /api/floors; os parâmetros do POST (da query ou do corpo) vêm em
+   req->params. */
+void http_api_get(const http_request_t *req, int id, void *conn, http_response_t *res);
+void http_api_post(const http_request_t *req, int id, void *conn, http_response_t *res);
+void http_api_batch(const http_request_t *req, int id, void *conn, http_response_t *res);        // POST /api/floors/batch
+void http_api_not_allowed(const http_request_t *req, int id, void *conn, http_response_t *res);   // 405
+void http_api_batch_not_allowed(const http_request_t *req, int id, void *conn, http_response_t *res);   // 405, só POST
+void http_api_not_found(const http_request_t *req, int id, void *conn, http_response_t *res);     // 404
+
+// Entradas da tabela de rotas (http_route_t) da API
+#define HTTP_API_HANDLERS                                                                         \
+    { [HTTP_METHOD_OTHER] = http_api_not_allowed, [HTTP_METHOD_GET] = http_api_get,              \
+      [HTTP_METHOD_POST] = http_api_post }
+#define HTTP_API_ROUTES                                                                           \
+    { "/api/floors", HTTP_API_HANDLERS },                                                         \
+    { "/api/floors/#", HTTP_API_HANDLERS },                                                       \
+    { "/api/floors/batch", { [HTTP_METHOD_OTHER] = http_api_batch_not_allowed, [HTTP_METHOD_POST] = http_api_batch } }
+
+#endif
@@ -0,0 +1,54 @@
+/**
+ * Arquivos estáticos da interface web (ver http_assets.h).
+ */
+#include "http_assets.h"
+#include "http_server.h"
+
+#include <string.h>
+
+#include "generated/web_assets.h"
+
+_Static_assert(WEB_ASSETS_RESPONSE_MAX <= HTTP_SERVER_RESPONSE_MAX,
+               "arquivo de web/ grande demais para HTTP_SERVER_RESPONSE_MAX");
+
+static const char asset_404[] =
+    "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n\r\n";
+
+const http_asset_t *http_asset_find(const char *path) {
+    for (size_t i = 0; i < WEB_ASSETS_COUNT; i++)
+        if (strcmp(web_assets[i].path, path) == 0)
+            return &web_assets[i];
+    return NULL;
+}
+
+// Procura "xxxxxxxx" em qualquer posição: cobre W/"..." e listas separadas por vírgula
+static bool etag_matches(const http_asset_variant_t *v, const char *if_none_match, size_t len) {
+    size_t n = strlen(v->etag);
+    for (size_t i = 0; i + n <= len; i++) {
+        if (memcmp(if_none_match + i, v->etag, n) == 0)
+            return true;
+    }
+    return false;
+}
+
+void http_asset_respond(const http_asset_t *asset, const http_request_t *req, http_response_t *res) {
+    const http_asset_variant_t *v = req->accept_gzip ? &asset->gzip : &asset->identity;
+    if (req->if_none_match_len && etag_matches(v, req->if_none_match, req->if_none_match_len)) {
+        http_response_fixed(res, v->not_modified, v->not_modified_len);
+        return;
+    }
+    http_segment_set(&res->local[0], v->head, v->head_len, false);
+    http_segment_set(&res->local[1], v->body, v->body_len, false);
+    res->seg = res->local;
+    res->count = HTTP_ASSETS_SEGMENTS;
+}
+
+void http_assets_get(const http_request_t *req, int id, void *conn, http_response_t *res) {
+    (void)id;
+    (void)conn;
+    const http_asset_t *asset = http_asset_find(req->path);
+    if (asset)
+        http_asset_respond(asset, req, res);
+    else
+        http_response_fixed(res, asset_404, sizeof(asset_404) - 1);
+}
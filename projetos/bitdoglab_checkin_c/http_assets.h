@@ -0,0 +1,57 @@
+/**
+ * Arquivos estáticos da interface web (HTML, CSS, JS), servidos da flash.
+ *
+ * Os arquivos de web/ são comprimidos no PC por tools/gen_assets.c, que
+ * escreve generated/web_assets.h com as respostas prontas: cada arquivo tem
+ * uma variante gzip e uma original, cada uma com cabeçalho, corpo e 304
+ * constantes. Responder é escolher a variante (Accept-Encoding, já lido
+ * pelo http_parser) e apontar dois segmentos para a flash; nada é gerado nem
+ * comprimido no Pico, e o único custo por resposta é a cópia da flash para os
+ * pbufs que o tcp_write faz (LWIP_NETIF_TX_SINGLE_PBUF, ver lwipopts.h). A
+ * ETag vem do conteúdo, então o navegador revalida e recebe 304 até o
+ * firmware mudar.
+ *
+ * O estado não está nos arquivos: a página busca /api/floors e /events
+ * (http_api.c, http_events.c).
+ */
+#ifndef HTTP_ASSETS_H
+#define HTTP_ASSETS_H
+
+#include <stdint.h>
+
+#include "http_parser.h"
+#include "http_router.h"
+
+// Resposta 200: cabeçalho e corpo, ambos da flash
+#define HTTP_ASSETS_SEGMENTS 2
+_Static_assert(HTTP_ASSETS_SEGMENTS <= HTTP_RESPONSE_SEGMENTS, "asset nao cabe em http_response_t");
+
+// Uma codificação do arquivo, com as respostas prontas
+typedef struct {
+    const char *head;           // status e cabeçalhos, até a linha em branco
+    const char *body;
+    const char *not_modified;   // resposta 304 inteira
+    const char *etag;           // "xxxxxxxx", com as aspas
+    uint16_t head_len;
+    uint16_t body_len;
+    uint16_t not_modified_len;
+} http_asset_variant_t;
+
+typedef struct {
+    const char *path;
+    http_asset_variant_t gzip;       // Content-Encoding: gzip
+    http_asset_variant_t identity;   // para quem não manda Accept-Encoding: gzip
+} http_asset_t;
+
+// Arquivo servido no caminho (sem a query), ou NULL
+const http_asset_t *http_asset_find(const char *path);
+
+/* Preenche res com o arquivo: gzip se req->accept_gzip, 304 se o
+   If-None-Match tem a ETag da variante escolhida. */
+void http_asset_respond(const http_asset_t *asset, const http_request_t *req, http_response_t *res);
+
+/* Handler (http_handler_fn) das rotas de arquivos: acha o arquivo pelo
+   caminho da requisição; 404 se não houver. */
+void http_assets_get(const http_request_t *req, int id, void *conn, http_response_t *res);
+
+#endif
@@ -0,0 +1,187 @@
+/**
+ * Server-Sent Events para as mudanças de ocupação (ver http_events.h).
+ */
+#include "http_events.h"
+#include "http_api.h"
+#include "occupancy.h"
+
+#include <string.h>
+
+// Os pcbs dos inscritos entram na conta de http_server.c (MEMP_NUM_TCP_PCB)
+// Metade dos segmentos TCP fica para as demais conexões
+_Static_assert(HTTP_EVENTS_MAX_SUBSCRIBERS * HTTP_EVENTS_MAX_QUEUED <= MEMP_NUM_TCP_SEG / 2,
+               "inscritos x fila passam de metade de MEMP_NUM_TCP_SEG");
+_Static_assert(HTTP_EVENTS_MAX_QUEUED <= TCP_SND_QUEUELEN, "HTTP_EVENTS_MAX_QUEUED > TCP_SND_QUEUELEN");
+
+// Maior mensagem: o estado completo, ou uma linha por andar
+#define EVENT_BUFFER 256
+_Static_assert(HTTP_EVENTS_MAX_QUEUED * EVENT_BUFFER <= TCP_SND_BUF, "fila dos inscritos passa de TCP_SND_BUF");
+
+typedef struct {
+    struct tcp_pcb *pcb;   // NULL: vaga livre
+    bool stale;            // perdeu mudanças; recebe o estado completo quando a fila esvaziar
+    uint8_t idle_polls;
+} subscriber_t;
+
+static subscriber_t subscribers[HTTP_EVENTS_MAX_SUBSCRIBERS];
+static int published[NUM_FLOORS];   // ocupação enviada na última publicação
+
+static const char events_head[] =
+    "HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\nCache-Control: no-cache\r\n"
+    "Access-Control-Allow-Origin: *\r\nConnection: keep-alive\r\n\r\n"
+    "retry: 3000\n\n";
+
+static const char events_busy[] =
+    "HTTP/1.1 503 Service Unavailable\r\nContent-Type: text/plain\r\nRetry-After: 5\r\n"
+    "Content-Length: 12\r\nConnection: close\r\n\r\nsem vagas.\r\n";
+
+static const char events_ping[] = ": ping\n\n";
+
+/* ─── ENVIO ────────────────────────────────────────────────────────── */
+static bool has_room(struct tcp_pcb *pcb, size_t len) {
+    return tcp_sndqueuelen(pcb) < HTTP_EVENTS_MAX_QUEUED && tcp_sndbuf(pcb) >= len;
+}
+
+// Estado completo: "event: floors\ndata: {...}\n\n"
+static bool send_snapshot(subscriber_t *s) {
+    char buf[EVENT_BUFFER];
+    http_writer_t w;
+    http_writer_init(&w, buf, sizeof(buf));
+    http_put_str(&w, "event: floors\ndata: ");
+    http_api_put_floors(&w);
+    http_put_str(&w, "\n\n");
+    size_t len = (size_t)(w.pos - buf);
+    if (w.overflow || !has_room(s->pcb, len) || tcp_write(s->pcb, buf, (u16_t)len, TCP_WRITE_FLAG_COPY) != ERR_OK) {
+        s->stale = true;
+        return false;
+    }
+    s->stale = false;
+    s->idle_polls = 0;
+    tcp_output(s->pcb);
+    return true;
+}
+
+// Libera a vaga e, com close, fecha o pcb. Retorna ERR_ABRT se precisou abortar.
+static err_t unsubscribe(subscriber_t *s, bool close) {
+    struct tcp_pcb *pcb = s->pcb;
+    s->pcb = NULL;
+    if (!close || !pcb)
+        return ERR_OK;
+    tcp_arg(pcb, NULL);
+    tcp_recv(pcb, NULL);
+    tcp_sent(pcb, NULL);
+    tcp_err(pcb, NULL);
+    tcp_poll(pcb, NULL, 0);
+    if (tcp_close(pcb) != ERR_OK) {
+        tcp_abort(pcb);
+        return ERR_ABRT;
+    }
+    return ERR_OK;
+}
+
+/* ─── CALLBACKS DO LWIP ────────────────────────────────────────────── */
+static err_t events_recv(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t err) {
+    subscriber_t *s = arg;
+    if (p == NULL)   // cliente fechou
+        return unsubscribe(s, true);
+    // nada a ler numa conexão de eventos
+    tcp_recved(pcb, p->tot_len);
+    pbuf_free(p);
+    return ERR_OK;
+}
+
+// A fila andou: quem está atrasado recebe o estado completo
+static err_t events_sent(void *arg, struct tcp_pcb *pcb, u16_t len) {
+    subscriber_t *s = arg;
+    if (s->stale)
+        send_snapshot(s);
+    return ERR_OK;
+}
+
+static err_t events_poll(void *arg, struct tcp_pcb *pcb) {
+    subscriber_t *s = arg;
+    if (s->stale) {
+        send_snapshot(s);
+    } else if (++s->idle_polls >= HTTP_EVENTS_PING_POLLS && has_room(pcb, sizeof(events_ping) - 1)) {
+        s->idle_polls = 0;
+        tcp_write(pcb, events_ping, sizeof(events_ping) - 1, 0);
+        tcp_output(pcb);
+    }
+    return ERR_OK;
+}
+
+// O lwIP já liberou o pcb (RST ou erro)
+static void events_err(void *arg, err_t err) {
+    unsubscribe(arg, false);
+}
+
+/* ─── API ──────────────────────────────────────────────────────────── */
+bool http_events_subscribe(struct tcp_pcb *pcb) {
+    subscriber_t *s = NULL;
+    for (int i = 0; i < HTTP_EVENTS_MAX_SUBSCRIBERS; i++) {
+        if (!subscribers[i].pcb) {
+            s = &subscribers[i];
+            break;
+        }
+    }
+    if (!s)
+        return false;
+
+    // primeira conexão: o estado atual é a referência das mudanças
+    bool first = true;
+    for (int i = 0; i < HTTP_EVENTS_MAX_SUBSCRIBERS; i++)
+        if (subscribers[i].pcb)
+            first = false;
+    if (first)
+        memcpy(published, occupancy, sizeof(published));
+
+    s->pcb = pcb;
+    s->stale = false;
+    s->idle_polls = 0;
+    tcp_arg(pcb, s);
+    tcp_recv(pcb, events_recv);
+    tcp_sent(pcb, events_sent);
+    tcp_err(pcb, events_err);
+    tcp_poll(pcb, events_poll, 1);
+
+    tcp_write(pcb, events_head, sizeof(events_head) - 1, TCP_WRITE_FLAG_MORE);
+    send_snapshot(s);
+    return true;
+}
+
+size_t http_events_busy(http_segment_t *seg) {
+    http_segment_set(seg, events_busy, sizeof(events_busy) - 1, false);
+    return 1;
+}
+
+void http_events_publish(void) {
+    char buf[EVENT_BUFFER];
+    http_writer_t w;
+    http_writer_init(&w, buf, sizeof(buf));
+
+    // uma linha "data:" por andar que mudou
+    for (int i = 0; i < NUM_FLOORS; i++) {
+        if (occupancy[i] == published[i])
+            continue;
+        published[i] = occupancy[i];
+        http_put_str(&w, "data: ");
+        http_api_put_floor(&w, i);
+        http_put_str(&w, "\n\n");
+    }
+    size_t len = (size_t)(w.pos - buf);
+    if (!len)
+        return;
+
+    for (int i = 0; i < HTTP_EVENTS_MAX_SUBSCRIBERS; i++) {
+        subscriber_t *s = &subscribers[i];
+        if (!s->pcb || s->stale)
+            continue;
+        if (w.overflow || !has_room(s->pcb, len) ||
+            tcp_write(s->pcb, buf, (u16_t)len, TCP_WRITE_FLAG_COPY) != ERR_OK) {
+            s->stale = true;
+            continue;
+        }
+        s->idle_polls = 0;
+        tcp_output(s->pcb);
+    }
+}
@@ -0,0 +1,51 @@
+/**
+ * Server-Sent Events: GET /events mantém a conexão aberta e recebe uma
+ * linha por andar alterado sempre que occupancy[] muda.
+ *
+ *   event: floors                                   (ao conectar e depois de atraso)
+ *   data: {"version":N,"selected":S,"max":50,"floors":[...]}
+ *
+ *   data: {"floor":2,"count":17}                    (a cada mudança)
+ *
+ * No navegador: new EventSource("/events"); onmessage recebe as mudanças e
+ * addEventListener("floors", ...) o estado completo.
+ *
+ * O número de inscritos e o que cada um pode ter na fila de envio são
+ * limitados pelos pools do lwIP (lwipopts.h): um cliente lento não acumula
+ * segmentos; ele é marcado como atrasado e, quando a fila esvazia, recebe o
+ * estado completo no lugar das mudanças perdidas.
+ */
+#ifndef HTTP_EVENTS_H
+#define HTTP_EVENTS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "lwip/tcp.h"
+#include "http_writer.h"
+
+// Conexões /events abertas ao mesmo tempo (cada uma ocupa um tcp_pcb)
+#ifndef HTTP_EVENTS_MAX_SUBSCRIBERS
+#define HTTP_EVENTS_MAX_SUBSCRIBERS 3
+#endif
+
+// pbufs na fila de envio de um inscrito antes de ele ser considerado atrasado
+#ifndef HTTP_EVENTS_MAX_QUEUED
+#define HTTP_EVENTS_MAX_QUEUED 4
+#endif
+
+// Comentário ": ping" a cada 30 x 0,5 s sem eventos, para detectar clientes que sumiram
+#define HTTP_EVENTS_PING_POLLS 30
+
+/* Assume a conexão (troca os callbacks do lwIP) e envia o cabeçalho e o
+   estado atual. Retorna false, sem mexer na conexão, se não houver vaga. */
+bool http_events_subscribe(struct tcp_pcb *pcb);
+
+// Resposta "503" para quando não há vaga (1 segmento, constante)
+size_t http_events_busy(http_segment_t *seg);
+
+/* Envia as mudanças de occupancy[] desde a última chamada a todos os
+   inscritos. Chamar no contexto do lwIP depois de alterar o estado. */
+void http_events_publish(void);
+
+#endif
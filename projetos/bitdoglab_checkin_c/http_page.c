@@ -0,0 +1,147 @@
+/**
+ * Página HTML do monitor de ocupação, montada em segmentos (ver http_page.h).
+ */
+#include "http_page.h"
+
+#include <string.h>
+
+/* ─── TEXTO FIXO (FLASH) ───────────────────────────────────────────── */
+// no-cache: o navegador pode guardar a página, mas revalida sempre (If-None-Match)
+static const char page_status[] =
+    "HTTP/1.1 200 OK\r\nContent-Type: text/html; charset=UTF-8\r\n"
+    "Cache-Control: no-cache\r\n";
+
+static const char page_not_modified[] =
+    "HTTP/1.1 304 Not Modified\r\n"
+    "Cache-Control: no-cache\r\n";
+
+static const char page_head[] =
+    "<!DOCTYPE html><html><head><meta charset=\"UTF-8\"><title>Monitor de Ocupacao</title>"
+    "<style>table, th, td { border: 1px solid black; border-collapse: collapse; padding: 8px; }</style>"
+    "</head><body>"
+    "<h1>Monitor de Ocupacao do Predio</h1>"
+    "<form action=\"/\" method=\"GET\">"
+    "<label for=\"floor\">Selecione o Andar:</label>"
+    "<select name=\"floor\" id=\"floor\">";
+
+static const char page_form[] =
+    "</select><br/><br/>"
+    "<input type=\"submit\" name=\"action\" value=\"add\"> "
+    "<input type=\"submit\" name=\"action\" value=\"remove\"> "
+    "<input type=\"submit\" name=\"action\" value=\"clear\"> "
+    "<input type=\"submit\" name=\"action\" value=\"clear_all\"> <br/><br/>"
+    "Ou defina a ocupacao: <input type=\"text\" name=\"value\" placeholder=\"Numero\"> "
+    "<input type=\"submit\" name=\"action\" value=\"set\">"
+    "</form>"
+    "<h2>Status dos Andares</h2>"
+    "<table>"
+    "<tr><th>Andar</th><th>Ocupacao</th></tr>";
+
+static const char page_tail[] =
+    "</table>"
+    "</body></html>";
+
+/* ─── PARTES GERADAS ───────────────────────────────────────────────── */
+// "Terreo" ou "Andar N"
+static void put_floor_name(http_writer_t *w, int floor) {
+    if (floor == 0) {
+        http_put_str(w, "Terreo");
+    } else {
+        http_put_str(w, "Andar ");
+        http_put_int(w, floor);
+    }
+}
+
+size_t http_page_render(http_segment_t seg[HTTP_PAGE_SEGMENTS], char *dynamic, size_t dynamic_len,
+                        uint32_t version, const int *occupancy, int floors, int selected) {
+    http_writer_t w;
+    http_writer_init(&w, dynamic, dynamic_len);
+
+    // <option value="N" selected>Nome</option>
+    const char *options = w.pos;
+    for (int i = 0; i < floors; i++) {
+        http_put_str(&w, "<option value=\"");
+        http_put_int(&w, i);
+        http_put_str(&w, (i == selected) ? "\" selected>" : "\" >");
+        put_floor_name(&w, i);
+        http_put_str(&w, "</option>");
+    }
+    size_t options_len = (size_t)(w.pos - options);
+
+    // <tr><td>Nome</td><td>N pessoas</td></tr>
+    const char *rows = w.pos;
+    for (int i = 0; i < floors; i++) {
+        http_put_str(&w, "<tr><td>");
+        put_floor_name(&w, i);
+        http_put_str(&w, "</td><td>");
+        http_put_int(&w, occupancy[i]);
+        http_put_str(&w, " pessoas</td></tr>");
+    }
+    size_t rows_len = (size_t)(w.pos - rows);
+
+    // Cabeçalho gerado por último, quando o tamanho do corpo já é conhecido:
+    // ETag: "xxxxxxxx", Content-Length e a linha em branco que fecha o cabeçalho
+    const char *etag = w.pos;
+    http_put_str(&w, "ETag: \"");
+    http_put_hex32(&w, version);
+    http_put_str(&w, "\"\r\nContent-Length: ");
+    http_put_uint(&w, (uint32_t)(sizeof(page_head) - 1 + options_len + sizeof(page_form) - 1 +
+                                 rows_len + sizeof(page_tail) - 1));
+    http_put_str(&w, "\r\n\r\n");
+    size_t etag_len = (size_t)(w.pos - etag);
+
+    if (w.overflow)
+        return 0;
+
+    http_segment_set(&seg[0], page_status, sizeof(page_status) - 1, false);
+    http_segment_set(&seg[1], etag, etag_len, true);
+    http_segment_set(&seg[2], page_head, sizeof(page_head) - 1, false);
+    http_segment_set(&seg[3], options, options_len, true);
+    http_segment_set(&seg[4], page_form, sizeof(page_form) - 1, false);
+    http_segment_set(&seg[5], rows, rows_len, true);
+    http_segment_set(&seg[6], page_tail, sizeof(page_tail) - 1, false);
+    return HTTP_PAGE_SEGMENTS;
+}
+
+/* ─── CACHE POR VERSÃO ─────────────────────────────────────────────── */
+// Posição da ETag entre aspas dentro do segmento 'ETag: "xxxxxxxx"\r\nContent-Length: ...'
+#define ETAG_QUOTED_OFFSET 6
+#define ETAG_QUOTED_LEN    10
+
+void http_page_cache_init(http_page_cache_t *cache) {
+    memset(cache, 0, sizeof(*cache));
+}
+
+const http_segment_t *http_page_get(http_page_cache_t *cache, size_t *count, uint32_t version,
+                                    const int *occupancy, int floors, int selected) {
+    if (!cache->valid || cache->version != version) {
+        cache->count = http_page_render(cache->seg, cache->dynamic, sizeof(cache->dynamic),
+                                        version, occupancy, floors, selected);
+        cache->version = version;
+        cache->valid = true;
+        cache->renders++;
+    }
+    *count = cache->count;
+    return cache->seg;
+}
+
+bool http_page_etag_matches(const http_page_cache_t *cache, const char *if_none_match, size_t len) {
+    if (!cache->valid || !cache->count)
+        return false;
+    const char *etag = cache->seg[1].data + ETAG_QUOTED_OFFSET;
+    // procura "xxxxxxxx" em qualquer posição: cobre W/"..." e listas separadas por vírgula
+    for (size_t i = 0; i + ETAG_QUOTED_LEN <= len; i++) {
+        if (memcmp(if_none_match + i, etag, ETAG_QUOTED_LEN) == 0)
+            return true;
+    }
+    return false;
+}
+
+size_t http_page_not_modified(const http_page_cache_t *cache, http_segment_t seg[HTTP_PAGE_NOT_MODIFIED_SEGMENTS]) {
+    static const char end[] = "\r\n\r\n";
+    // 304 não tem corpo: só a linha da ETag, sem o Content-Length da página
+    http_segment_set(&seg[0], page_not_modified, sizeof(page_not_modified) - 1, false);
+    http_segment_set(&seg[1], cache->seg[1].data, ETAG_QUOTED_OFFSET + ETAG_QUOTED_LEN, true);
+    http_segment_set(&seg[2], end, sizeof(end) - 1, false);
+    return HTTP_PAGE_NOT_MODIFIED_SEGMENTS;
+}
@@ -0,0 +1,67 @@
+/**
+ * Página HTML do monitor de ocupação, montada em segmentos.
+ *
+ * O texto fixo da página fica em constantes na flash e não é montado em RAM:
+ * cada segmento vai da flash direto para o pbuf do lwIP, numa cópia só, no
+ * tcp_write (com LWIP_NETIF_TX_SINGLE_PBUF, ver lwipopts.h, o lwIP copia
+ * tudo, mesmo sem TCP_WRITE_FLAG_COPY). Só as partes que dependem do estado
+ * (opções do <select> e linhas da tabela) são geradas num buffer pequeno.
+ *
+ * As partes geradas ficam em cache junto com a versão do estado
+ * (occupancy_version) usada para gerá-las, e só são refeitas quando a versão
+ * muda. A versão também é a ETag da resposta: um navegador que manda
+ * If-None-Match com a ETag atual recebe só um 304.
+ */
+#ifndef HTTP_PAGE_H
+#define HTTP_PAGE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "http_writer.h"
+
+// Número de segmentos da resposta: 4 fixos intercalados com 3 gerados
+#define HTTP_PAGE_SEGMENTS 7
+
+// Segmentos da resposta 304: status fixo, ETag, fim do cabeçalho
+#define HTTP_PAGE_NOT_MODIFIED_SEGMENTS 3
+
+// Espaço suficiente para as partes geradas com 5 andares e qualquer valor int
+#define HTTP_PAGE_DYNAMIC  512
+
+// Resposta pronta para uma versão do estado
+typedef struct {
+    bool valid;
+    uint32_t version;
+    size_t count;                            // segmentos em seg, 0 se não coube em dynamic
+    http_segment_t seg[HTTP_PAGE_SEGMENTS];
+    char dynamic[HTTP_PAGE_DYNAMIC];
+    uint32_t renders;                        // quantas vezes foi gerada (estatística)
+} http_page_cache_t;
+
+/* Preenche seg[] com a resposta completa (cabeçalho HTTP + página) para o
+   estado na versão version. As partes geradas são escritas em dynamic, que
+   precisa continuar válido só até os tcp_write com cópia. Retorna o número
+   de segmentos, ou 0 se dynamic for pequeno demais. */
+size_t http_page_render(http_segment_t seg[HTTP_PAGE_SEGMENTS], char *dynamic, size_t dynamic_len,
+                        uint32_t version, const int *occupancy, int floors, int selected);
+
+// Esvazia o cache
+void http_page_cache_init(http_page_cache_t *cache);
+
+/* Segmentos da resposta para a versão version, gerados de novo só se a
+   versão mudou desde a última chamada. *count recebe o número de segmentos
+   (0 em caso de erro). Os segmentos valem até a próxima chamada. */
+const http_segment_t *http_page_get(http_page_cache_t *cache, size_t *count, uint32_t version,
+                                    const int *occupancy, int floors, int selected);
+
+/* true se o valor do cabeçalho If-None-Match (sem o nome, não precisa de
+   '\0') contém a ETag da versão em cache. Aceita listas e o prefixo W/. */
+bool http_page_etag_matches(const http_page_cache_t *cache, const char *if_none_match, size_t len);
+
+/* Segmentos da resposta "304 Not Modified" para a versão em cache.
+   Retorna o número de segmentos. */
+size_t http_page_not_modified(const http_page_cache_t *cache, http_segment_t seg[HTTP_PAGE_NOT_MODIFIED_SEGMENTS]);
+
+#endif
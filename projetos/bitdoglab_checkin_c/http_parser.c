@@ -0,0 +1,476 @@
+/**
+ * Leitor de requisições HTTP/1.1 incremental (ver http_parser.h).
+ *
+ * Um byte por vez, sem voltar atrás: o estado entre dois pedaços é só
+ * http_parser_t, então não importa onde os pbufs cortam a requisição.
+ */
+#include "http_parser.h"
+
+#include <string.h>
+
+enum {
+    ST_METHOD,
+    ST_PATH,
+    ST_QUERY,
+    ST_VERSION,
+    ST_LINE_LF,       // '\r' da linha de requisição lido, falta o '\n'
+    ST_HEADER_START,
+    ST_HEADER_NAME,
+    ST_HEADER_VALUE,
+    ST_HEADER_LF,
+    ST_HEAD_END_LF,   // '\r' da linha em branco lido
+    ST_BODY,
+    ST_DONE,
+    ST_BAD,
+    ST_TOO_LARGE,
+};
+
+enum {
+    HDR_OTHER,
+    HDR_CONTENT_LENGTH,
+    HDR_CONNECTION,
+    HDR_IF_NONE_MATCH,
+    HDR_TRANSFER_ENCODING,
+    HDR_ACCEPT_ENCODING,
+};
+
+// Bits de http_parser_t.codings
+enum {
+    CODING_GZIP    = 1,   // gzip apareceu em Accept-Encoding
+    CODING_GZIP_OK = 2,   // ... com q diferente de 0
+    CODING_ANY_OK  = 4,   // "*" com q diferente de 0 (vale para gzip se ele não apareceu)
+};
+
+// Resultados de decode() que não são um byte
+#define DECODE_MORE -1
+#define DECODE_BAD  -2
+
+static char lower(char c) {
+    return (c >= 'A' && c <= 'Z') ? (char)(c + 'a' - 'A') : c;
+}
+
+static int hex(char c) {
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    c = lower(c);
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    return -1;
+}
+
+void http_parser_init(http_parser_t *p) {
+    memset(p, 0, sizeof(*p));
+    p->state = ST_METHOD;
+}
+
+http_parse_status_t http_parser_status(const http_parser_t *p) {
+    switch (p->state) {
+    case ST_DONE:      return HTTP_PARSE_DONE;
+    case ST_BAD:       return HTTP_PARSE_BAD_REQUEST;
+    case ST_TOO_LARGE: return HTTP_PARSE_TOO_LARGE;
+    default:           return HTTP_PARSE_INCOMPLETE;
+    }
+}
+
+/* ─── %XX ──────────────────────────────────────────────────────────── */
+// O byte decodificado, DECODE_MORE no meio de um %XX ou DECODE_BAD (%00 também)
+static int decode(http_parser_t *p, char c) {
+    if (p->pct) {
+        int d = hex(c);
+        if (d < 0)
+            return DECODE_BAD;
+        p->pct_value = (uint8_t)(p->pct_value << 4 | d);
+        if (++p->pct < 3)
+            return DECODE_MORE;
+        p->pct = 0;
+        return p->pct_value ? p->pct_value : DECODE_BAD;
+    }
+    if (c == '%') {
+        p->pct = 1;
+        p->pct_value = 0;
+        return DECODE_MORE;
+    }
+    return (unsigned char)c;
+}
+
+static void too_large(http_parser_t *p, http_limit_t limit) {
+    p->limit = limit;
+    p->state = ST_TOO_LARGE;
+}
+
+/* ─── PARÂMETROS (QUERY E CORPO) ───────────────────────────────────── */
+static bool param_append(http_parser_t *p, char c) {
+    if (p->param_len >= HTTP_PARSER_PARAMS_MAX) {
+        too_large(p, p->state == ST_BODY ? HTTP_LIMIT_BODY : HTTP_LIMIT_URI);
+        return false;
+    }
+    p->req.params[p->param_len++] = c;
+    return true;
+}
+
+// Fecha o par atual ("chave" sozinha vira chave com valor vazio; "&&" é ignorado)
+static void param_end(http_parser_t *p) {
+    if (p->pct) {
+        p->state = ST_BAD;   // %X cortado
+        return;
+    }
+    if (p->param_len != p->pair_start || p->in_value) {
+        if (!p->in_value && !param_append(p, '\0'))
+            return;
+        if (!param_append(p, '\0'))
+            return;
+        p->req.param_count++;
+    }
+    p->pair_start = p->param_len;
+    p->in_value = false;
+}
+
+static void param_char(http_parser_t *p, char c) {
+    if (!p->pct) {
+        switch (c) {
+        case '&':
+            param_end(p);
+            return;
+        case '=':
+            if (!p->in_value) {
+                p->in_value = param_append(p, '\0');
+                return;
+            }
+            break;
+        case '+':
+            param_append(p, ' ');
+            return;
+        case '\r':
+        case '\n':   // fim de linha depois do corpo (curl -d, formulários)
+            return;
+        }
+    }
+    int d = decode(p, c);
+    if (d == DECODE_BAD)
+        p->state = ST_BAD;
+    else if (d >= 0)
+        param_append(p, (char)d);
+}
+
+/* ─── CABEÇALHOS ───────────────────────────────────────────────────── */
+static bool name_is(const http_parser_t *p, const char *name) {
+    size_t n = strlen(name);
+    return p->name_len == n && memcmp(p->name, name, n) == 0;
+}
+
+static void header_start(http_parser_t *p) {
+    p->header = HDR_OTHER;
+    if (name_is(p, "content-length")) {
+        if (p->has_length) {   // dois Content-Length: não dá para saber onde o corpo acaba
+            p->state = ST_BAD;
+            return;
+        }
+        p->has_length = true;
+        p->header = HDR_CONTENT_LENGTH;
+    } else if (name_is(p, "connection")) {
+        p->header = HDR_CONNECTION;
+    } else if (name_is(p, "if-none-match")) {
+        p->header = HDR_IF_NONE_MATCH;
+    } else if (name_is(p, "transfer-encoding")) {
+        p->header = HDR_TRANSFER_ENCODING;
+    } else if (name_is(p, "accept-encoding")) {
+        p->header = HDR_ACCEPT_ENCODING;
+    }
+    p->token_len = 0;
+    p->value_started = false;
+    p->state = ST_HEADER_VALUE;
+}
+
+/* Fim de um item de Accept-Encoding, já sem espaços: "gzip", "gzip;q=0.8",
+   "*;q=0"... Só q=0 (0, 0.0, 0.000) recusa a codificação. */
+static void coding_end(http_parser_t *p) {
+    p->token[p->token_len] = '\0';
+    p->token_len = 0;
+    bool refused = false;
+    char *params = strchr(p->token, ';');
+    if (params) {
+        *params++ = '\0';
+        const char *q = strstr(params, "q=");
+        if (q) {
+            refused = true;
+            for (q += 2; *q && *q != ';'; q++)
+                if (*q != '0' && *q != '.')
+                    refused = false;
+        }
+    }
+    if (strcmp(p->token, "gzip") == 0 || strcmp(p->token, "x-gzip") == 0)
+        p->codings |= CODING_GZIP | (refused ? 0 : CODING_GZIP_OK);
+    else if (strcmp(p->token, "*") == 0 && !refused)
+        p->codings |= CODING_ANY_OK;
+}
+
+static void header_value(http_parser_t *p, char c) {
+    if (!p->value_started) {
+        if (c == ' ' || c == '\t')
+            return;
+        p->value_started = true;
+    }
+    switch (p->header) {
+    case HDR_CONTENT_LENGTH:
+        // token_len marca os espaços depois do número: só podem vir no fim ("12 34" é inválido)
+        if (c >= '0' && c <= '9' && !p->token_len) {
+            p->req.content_length = p->req.content_length * 10 + (uint32_t)(c - '0');
+            if (p->req.content_length > HTTP_PARSER_BODY_MAX)
+                too_large(p, HTTP_LIMIT_BODY);
+        } else if (c == ' ' || c == '\t') {
+            p->token_len = 1;
+        } else {
+            p->state = ST_BAD;
+        }
+        break;
+    case HDR_CONNECTION:
+        if (p->token_len < sizeof(p->token) - 1)
+            p->token[p->token_len++] = lower(c);
+        break;
+    case HDR_IF_NONE_MATCH:
+        if (p->req.if_none_match_len < HTTP_PARSER_ETAG_MAX)
+            p->req.if_none_match[p->req.if_none_match_len++] = c;
+        break;
+    case HDR_TRANSFER_ENCODING:
+        p->state = ST_BAD;   // corpo chunked não é aceito
+        break;
+    case HDR_ACCEPT_ENCODING:
+        if (c == ',')
+            coding_end(p);
+        else if (c != ' ' && c != '\t' && p->token_len < sizeof(p->token) - 1)
+            p->token[p->token_len++] = lower(c);
+        break;
+    }
+}
+
+/* Valor de um cabeçalho que não interessa (User-Agent, Accept, Cookie...),
+   a maior parte dos bytes de uma requisição de navegador: pula até o fim da
+   linha com memchr, sem passar byte a byte pela máquina. Para no limite do
+   cabeçalho, para o byte seguinte dar TOO_LARGE como na leitura normal. */
+static size_t skip_value(http_parser_t *p, const char *data, size_t len) {
+    size_t room = HTTP_PARSER_HEAD_MAX - p->head_len;
+    if (len > room)
+        len = room;
+    const char *end = memchr(data, '\r', len);
+    if (end)
+        len = (size_t)(end - data);
+    end = memchr(data, '\n', len);
+    if (end)
+        len = (size_t)(end - data);
+    p->head_len = (uint16_t)(p->head_len + len);
+    return len;
+}
+
+// Nome do cabeçalho: copia em minúsculas até o ':' ou o fim da linha, que a máquina trata
+static size_t scan_name(http_parser_t *p, const char *data, size_t len) {
+    size_t room = HTTP_PARSER_HEAD_MAX - p->head_len;
+    if (len > room)
+        len = room;
+    size_t n = 0;
+    for (; n < len; n++) {
+        char c = data[n];
+        if (c == ':' || c == '\r' || c == '\n')
+            break;
+        if (p->name_len < sizeof(p->name))
+            p->name[p->name_len++] = lower(c);   // nome mais longo: não é nenhum dos conhecidos
+    }
+    p->head_len = (uint16_t)(p->head_len + n);
+    return n;
+}
+
+static void header_end(http_parser_t *p) {
+    if (p->header == HDR_ACCEPT_ENCODING) {
+        coding_end(p);
+    } else if (p->header == HDR_CONNECTION) {
+        p->token[p->token_len] = '\0';
+        if (strstr(p->token, "close"))
+            p->req.close = true;
+        else if (strstr(p->token, "keep-alive"))
+            p->req.close = false;
+    }
+}
+
+static void head_end(http_parser_t *p) {
+    if (p->codings & CODING_GZIP)
+        p->req.accept_gzip = p->codings & CODING_GZIP_OK;
+    else
+        p->req.accept_gzip = p->codings & CODING_ANY_OK;
+    if (p->req.content_length) {
+        p->body_left = p->req.content_length;
+        p->state = ST_BODY;
+    } else {
+        p->state = ST_DONE;
+    }
+}
+
+/* ─── LINHA DE REQUISIÇÃO ──────────────────────────────────────────── */
+static void method_end(http_parser_t *p) {
+    p->token[p->token_len] = '\0';
+    if (strcmp(p->token, "GET") == 0)
+        p->req.method = HTTP_METHOD_GET;
+    else if (strcmp(p->token, "POST") == 0)
+        p->req.method = HTTP_METHOD_POST;
+    else
+        p->req.method = HTTP_METHOD_OTHER;
+    p->token_len = 0;
+    p->state = ST_PATH;
+}
+
+static void path_char(http_parser_t *p, char c) {
+    int d = decode(p, c);
+    if (d == DECODE_BAD) {
+        p->state = ST_BAD;
+    } else if (d >= 0) {
+        if (p->path_len >= HTTP_PARSER_PATH_MAX)
+            too_large(p, HTTP_LIMIT_URI);
+        else
+            p->req.path[p->path_len++] = (char)d;
+    }
+}
+
+static void version_end(http_parser_t *p, uint8_t next) {
+    p->token[p->token_len] = '\0';
+    if (strcmp(p->token, "HTTP/1.1") == 0) {
+        p->state = next;
+    } else if (strcmp(p->token, "HTTP/1.0") == 0) {
+        p->req.close = true;   // só fica aberta com Connection: keep-alive
+        p->state = next;
+    } else {
+        p->state = ST_BAD;
+    }
+}
+
+/* ─── MÁQUINA DE ESTADOS ───────────────────────────────────────────── */
+size_t http_parser_feed(http_parser_t *p, const char *data, size_t len) {
+    size_t i = 0;
+    while (i < len && p->state < ST_DONE) {
+        // Trechos longos sem nada a decidir, fora do switch
+        if (p->state == ST_HEADER_VALUE && p->header == HDR_OTHER)
+            i += skip_value(p, data + i, len - i);
+        else if (p->state == ST_HEADER_NAME)
+            i += scan_name(p, data + i, len - i);
+        if (i == len)
+            break;
+        char c = data[i++];
+        if (p->state < ST_BODY && ++p->head_len > HTTP_PARSER_HEAD_MAX) {
+            // ainda na linha de requisição: a query ("&&&...") é que passou
+            too_large(p, p->state == ST_PATH || p->state == ST_QUERY ? HTTP_LIMIT_URI : HTTP_LIMIT_HEAD);
+            break;
+        }
+
+        switch (p->state) {
+        case ST_METHOD:
+            if (c == ' ' && p->token_len)
+                method_end(p);
+            else if ((c == '\r' || c == '\n') && !p->token_len)
+                ;   // linhas em branco antes da requisição (RFC 9112, 2.2)
+            else if (c >= 'A' && c <= 'Z' && p->token_len < sizeof(p->token) - 1)
+                p->token[p->token_len++] = c;
+            else
+                p->state = ST_BAD;
+            break;
+
+        case ST_PATH:
+            if (c == ' ' || (c == '?' && !p->pct)) {
+                if (!p->path_len || p->pct)
+                    p->state = ST_BAD;
+                else
+                    p->state = (c == ' ') ? ST_VERSION : ST_QUERY;
+            } else if (c == '\r' || c == '\n') {
+                p->state = ST_BAD;
+            } else {
+                path_char(p, c);
+            }
+            break;
+
+        case ST_QUERY:
+            if (c == ' ') {
+                param_end(p);
+                if (p->state == ST_QUERY)
+                    p->state = ST_VERSION;
+            } else if (c == '\r' || c == '\n') {
+                p->state = ST_BAD;
+            } else {
+                param_char(p, c);
+            }
+            break;
+
+        case ST_VERSION:
+            if (c == '\r')
+                version_end(p, ST_LINE_LF);
+            else if (c == '\n')
+                version_end(p, ST_HEADER_START);
+            else if (p->token_len < sizeof(p->token) - 1)
+                p->token[p->token_len++] = c;
+            else
+                p->state = ST_BAD;
+            break;
+
+        case ST_LINE_LF:
+        case ST_HEADER_LF:
+            p->state = (c == '\n') ? ST_HEADER_START : ST_BAD;
+            break;
+
+        case ST_HEADER_START:
+            if (c == '\r') {
+                p->state = ST_HEAD_END_LF;
+            } else if (c == '\n') {
+                head_end(p);
+            } else if (c == ':') {
+                p->state = ST_BAD;
+            } else {
+                p->name[0] = lower(c);
+                p->name_len = 1;
+                p->state = ST_HEADER_NAME;
+            }
+            break;
+
+        case ST_HEADER_NAME:
+            if (c == ':') {
+                header_start(p);
+            } else if (c == '\r' || c == '\n') {
+                p->state = ST_BAD;
+            } else if (p->name_len < sizeof(p->name)) {
+                p->name[p->name_len++] = lower(c);   // só no limite do cabeçalho (scan_name para antes)
+            }
+            break;
+
+        case ST_HEADER_VALUE:
+            if (c == '\r' || c == '\n') {
+                header_end(p);
+                p->state = (c == '\r') ? ST_HEADER_LF : ST_HEADER_START;
+            } else {
+                header_value(p, c);
+            }
+            break;
+
+        case ST_HEAD_END_LF:
+            if (c == '\n')
+                head_end(p);
+            else
+                p->state = ST_BAD;
+            break;
+
+        case ST_BODY:
+            param_char(p, c);
+            if (--p->body_left == 0 && p->state == ST_BODY) {
+                param_end(p);
+                if (p->state == ST_BODY)
+                    p->state = ST_DONE;
+            }
+            break;
+        }
+    }
+    return i;
+}
+
+const char *http_param(const http_request_t *req, const char *key) {
+    const char *s = req->params;
+    for (uint8_t i = 0; i < req->param_count; i++) {
+        const char *value = s + strlen(s) + 1;
+        if (strcmp(s, key) == 0)
+            return value;
+        s = value + strlen(value) + 1;
+    }
+    return NULL;
+}
@@ -0,0 +1,105 @@
+/**
+ * Leitor de requisições HTTP/1.1 incremental (máquina de estados).
+ *
+ * Recebe os bytes em pedaços de qualquer tamanho, na ordem em que chegam
+ * (cada pbuf de uma cadeia, sem juntar nada antes), e decodifica numa
+ * passada só o método, o caminho, os parâmetros da query e do corpo
+ * (application/x-www-form-urlencoded, com %XX e '+') e os cabeçalhos que o
+ * servidor usa. Não guarda a requisição: só os campos já decodificados, em
+ * buffers fixos; o que não cabe vira erro, nunca escrita fora do buffer.
+ *
+ * Uso:
+ *   http_parser_init(&p);
+ *   for (q = pbuf; q; q = q->next)
+ *       usados = http_parser_feed(&p, q->payload, q->len);   // para no fim da requisição
+ *   if (http_parser_status(&p) == HTTP_PARSE_DONE) ... p.req ...
+ */
+#ifndef HTTP_PARSER_H
+#define HTTP_PARSER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Caminho decodificado, sem a query
+#define HTTP_PARSER_PATH_MAX   32
+// Parâmetros da query + corpo, guardados como "chave\0valor\0..."
+#define HTTP_PARSER_PARAMS_MAX 64
+// If-None-Match guardado (o resto é ignorado)
+#define HTTP_PARSER_ETAG_MAX   48
+// Linha de requisição + cabeçalhos
+#define HTTP_PARSER_HEAD_MAX   2048
+// Maior Content-Length aceito (o corpo decodificado ainda precisa caber nos parâmetros)
+#define HTTP_PARSER_BODY_MAX   256
+
+typedef enum {
+    HTTP_PARSE_INCOMPLETE,   // falta chegar o resto
+    HTTP_PARSE_DONE,         // requisição completa em p.req
+    HTTP_PARSE_BAD_REQUEST,  // 400
+    HTTP_PARSE_TOO_LARGE,    // 431/413/414: algum campo não cabe (qual, em p.limit)
+} http_parse_status_t;
+
+// Limite que deu HTTP_PARSE_TOO_LARGE
+typedef enum {
+    HTTP_LIMIT_HEAD,         // 431: cabeçalhos (HTTP_PARSER_HEAD_MAX)
+    HTTP_LIMIT_URI,          // 414: caminho ou query
+    HTTP_LIMIT_BODY,         // 413: Content-Length ou parâmetros do corpo
+} http_limit_t;
+
+typedef enum {
+    HTTP_METHOD_OTHER,
+    HTTP_METHOD_GET,
+    HTTP_METHOD_POST,
+} http_method_t;
+
+// Requisição decodificada
+typedef struct {
+    http_method_t method;
+    char path[HTTP_PARSER_PATH_MAX + 1];
+    char params[HTTP_PARSER_PARAMS_MAX];   // "chave\0valor\0" x param_count
+    uint8_t param_count;
+    char if_none_match[HTTP_PARSER_ETAG_MAX];
+    uint8_t if_none_match_len;
+    uint32_t content_length;
+    bool close;                            // Connection: close ou HTTP/1.0 sem keep-alive
+    bool accept_gzip;                      // Accept-Encoding com gzip (ou *) e q diferente de 0
+} http_request_t;
+
+typedef struct {
+    http_request_t req;
+
+    // estado da leitura
+    uint8_t state;
+    uint8_t limit;           // http_limit_t, com HTTP_PARSE_TOO_LARGE
+    uint8_t header;          // cabeçalho atual (enum interno)
+    uint8_t name_len;
+    uint8_t token_len;
+    uint8_t path_len;
+    uint8_t param_len;       // bytes usados em req.params
+    uint8_t pair_start;      // início do par chave=valor atual
+    bool in_value;           // depois do '=' do par atual
+    uint8_t pct;             // 0, ou dígitos já lidos de um %XX
+    uint8_t pct_value;
+    bool value_started;      // já passou dos espaços depois do ':'
+    bool has_length;         // já houve um Content-Length
+    uint8_t codings;         // o que já se viu em Accept-Encoding (bits internos)
+    uint16_t head_len;
+    uint32_t body_left;
+    char name[20];           // nome do cabeçalho atual, em minúsculas
+    char token[16];          // método, versão, valor de Connection ou item de Accept-Encoding
+} http_parser_t;
+
+// Prepara para a próxima requisição (inclusive numa conexão persistente)
+void http_parser_init(http_parser_t *p);
+
+/* Lê até len bytes de data. Para logo depois do último byte da requisição
+   (o resto é da próxima, em pipelining) ou num erro. Retorna quantos bytes
+   foram usados. */
+size_t http_parser_feed(http_parser_t *p, const char *data, size_t len);
+
+http_parse_status_t http_parser_status(const http_parser_t *p);
+
+// Valor do parâmetro key (da query ou do corpo), ou NULL se não houver
+const char *http_param(const http_request_t *req, const char *key);
+
+#endif
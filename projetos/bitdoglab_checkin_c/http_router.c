@@ -0,0 +1,101 @@
+/**
+ * Tabela de rotas HTTP (ver http_router.h).
+ */
+#include "http_router.h"
+
+#include <string.h>
+
+// Segmento numérico mais longo aceito como id (cabe em int)
+#define ID_DIGITS_MAX 4
+
+// FNV-1a de 32 bits
+#define FNV_OFFSET 2166136261u
+#define FNV_PRIME  16777619u
+
+static uint32_t fnv(uint32_t h, const char *s, size_t len) {
+    for (size_t i = 0; i < len; i++)
+        h = (h ^ (uint8_t)s[i]) * FNV_PRIME;
+    return h;
+}
+
+/* Hash do caminho como escrito na tabela. Se o último segmento for só de
+   dígitos, entra como '#' e o número vai para *id. */
+static uint32_t path_key(const char *path, size_t *key_len, int *id) {
+    size_t len = strlen(path), k = len;
+    while (k && path[k - 1] >= '0' && path[k - 1] <= '9')
+        k--;
+    *id = -1;
+    *key_len = len;
+    if (k < len && k && path[k - 1] == '/' && len - k <= ID_DIGITS_MAX) {
+        int n = 0;
+        for (size_t i = k; i < len; i++)
+            n = n * 10 + (path[i] - '0');
+        *id = n;
+        *key_len = k;
+        return fnv(fnv(FNV_OFFSET, path, k), "#", 1);
+    }
+    return fnv(FNV_OFFSET, path, len);
+}
+
+// A rota casa com os key_len primeiros bytes do caminho (+ '#' se numeric)
+static bool route_matches(const http_route_t *route, const char *path, size_t key_len, bool numeric) {
+    size_t n = strlen(route->path);
+    if (n != key_len + numeric || memcmp(route->path, path, key_len) != 0)
+        return false;
+    // um '#' no caminho pedido (%23) não casa com o '#' da rota
+    return numeric == (n && route->path[n - 1] == '#');
+}
+
+const http_route_t *http_router_find(const http_router_t *r, const char *path, int *id) {
+    size_t key_len;
+    uint32_t h = path_key(path, &key_len, id);
+    for (size_t probe = 0; probe < HTTP_ROUTER_SLOTS; probe++) {
+        uint8_t slot = r->slots[(h + probe) & (HTTP_ROUTER_SLOTS - 1)];
+        if (!slot)
+            return NULL;
+        const http_route_t *route = &r->routes[slot - 1];
+        if (route_matches(route, path, key_len, *id >= 0))
+            return route;
+    }
+    return NULL;
+}
+
+bool http_router_init(http_router_t *r, const http_route_t *routes, size_t count, const http_route_t *fallback) {
+    memset(r, 0, sizeof(*r));
+    r->routes = routes;
+    r->count = count;
+    r->fallback = fallback;
+    if (count > HTTP_ROUTER_SLOTS / 2)
+        return false;
+    for (size_t i = 0; i < count; i++) {
+        for (size_t k = 0; k < i; k++)
+            if (strcmp(routes[k].path, routes[i].path) == 0)
+                return false;
+        // FNV é sequencial: o hash de "/a/#" é o mesmo que path_key dá para "/a/12"
+        uint32_t h = fnv(FNV_OFFSET, routes[i].path, strlen(routes[i].path));
+        while (r->slots[h & (HTTP_ROUTER_SLOTS - 1)])
+            h++;
+        r->slots[h & (HTTP_ROUTER_SLOTS - 1)] = (uint8_t)(i + 1);
+    }
+    return true;
+}
+
+void http_router_dispatch(const http_router_t *r, const http_request_t *req, void *conn, http_response_t *res) {
+    int id;
+    const http_route_t *route = http_router_find(r, req->path, &id);
+    if (!route)
+        route = r->fallback;
+    http_handler_fn fn = route->handler[req->method];
+    if (!fn)
+        fn = route->handler[HTTP_METHOD_OTHER];
+    res->seg = res->local;
+    res->count = 0;
+    res->detached = false;
+    fn(req, id, conn, res);
+}
+
+void http_response_fixed(http_response_t *res, const char *text, size_t len) {
+    http_segment_set(&res->local[0], text, len, false);
+    res->seg = res->local;
+    res->count = 1;
+}
@@ -0,0 +1,75 @@
+/**
+ * Tabela de rotas HTTP: caminho + método -> handler.
+ *
+ * As rotas ficam num vetor constante (na flash), escrito onde o servidor é
+ * montado; http_router_init só monta um índice por hash do caminho, então
+ * achar a rota custa um hash do caminho e uma comparação, não importa
+ * quantas rotas existam. O método escolhe o handler direto pelo índice
+ * (http_method_t). Um último segmento só com dígitos ("/api/floors/3") casa
+ * com a rota escrita com '#' ("/api/floors/#") e o número vai para o handler
+ * (por isso uma rota não pode terminar num segmento só de dígitos).
+ *
+ * Não depende do lwIP: a conexão chega ao handler como void *.
+ */
+#ifndef HTTP_ROUTER_H
+#define HTTP_ROUTER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "http_parser.h"
+#include "http_writer.h"
+
+// Métodos que http_parser distingue (índices de http_route_t.handler)
+#define HTTP_METHODS (HTTP_METHOD_POST + 1)
+
+// Vagas do índice: potência de 2, com folga para as rotas (sondagem linear)
+#define HTTP_ROUTER_SLOTS 32
+
+// Resposta montada na hora: até 3 segmentos, partes geradas em buf
+#define HTTP_RESPONSE_SEGMENTS 3
+// Maior parte gerada: GET /api/floors com 5 andares e valores int quaisquer
+#define HTTP_RESPONSE_BUFFER   192
+
+typedef struct {
+    const http_segment_t *seg;                   // segmentos a enviar (local ou de um cache)
+    size_t count;                                // 0: erro ao montar
+    http_segment_t local[HTTP_RESPONSE_SEGMENTS];
+    char buf[HTTP_RESPONSE_BUFFER];
+    bool close;                                  // fecha a conexão depois desta resposta
+    bool detached;                               // a conexão passou para outro módulo: não enviar nada
+} http_response_t;
+
+/* id: número do segmento '#' da rota, ou -1. conn: a conexão de quem chamou
+   http_router_dispatch. */
+typedef void (*http_handler_fn)(const http_request_t *req, int id, void *conn, http_response_t *res);
+
+typedef struct {
+    const char *path;   // caminho exato; '#' no fim = segmento numérico
+    /* handler por método; handler[HTTP_METHOD_OTHER] responde os métodos
+       sem handler próprio (405) */
+    http_handler_fn handler[HTTP_METHODS];
+} http_route_t;
+
+typedef struct {
+    const http_route_t *routes;
+    size_t count;
+    const http_route_t *fallback;          // caminho sem rota
+    uint8_t slots[HTTP_ROUTER_SLOTS];      // índice da rota + 1; 0 = vaga livre
+} http_router_t;
+
+/* Monta o índice. Retorna false se houver rotas demais para
+   HTTP_ROUTER_SLOTS (metade das vagas, no máximo) ou caminho repetido. */
+bool http_router_init(http_router_t *r, const http_route_t *routes, size_t count, const http_route_t *fallback);
+
+// Rota do caminho (NULL se não houver); *id recebe o segmento numérico ou -1
+const http_route_t *http_router_find(const http_router_t *r, const char *path, int *id);
+
+// Acha a rota (ou o fallback) e chama o handler do método
+void http_router_dispatch(const http_router_t *r, const http_request_t *req, void *conn, http_response_t *res);
+
+// Resposta com um único segmento fixo (flash)
+void http_response_fixed(http_response_t *res, const char *text, size_t len);
+
+#endif
@@ -0,0 +1,430 @@
+/**
+ * Servidor HTTP/1.1 do checkin (ver http_server.h).
+ *
+ * Tudo roda nos callbacks do lwIP; nenhuma função aqui é chamada de outro
+ * contexto.
+ */
+#include "http_server.h"
+#include "http_api.h"
+#include "http_assets.h"
+#include "http_events.h"
+#include "http_page.h"
+#include "http_parser.h"
+#include "http_router.h"
+#include "occupancy.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lwip/tcp.h"
+
+// tcp_poll conta em períodos de 500 ms: POLL_INTERVAL = 1 s
+#define POLL_INTERVAL 2
+
+// Um pcb a mais para a conexão recusada com 503
+_Static_assert(HTTP_SERVER_MAX_CONNECTIONS + HTTP_EVENTS_MAX_SUBSCRIBERS + 1 <= MEMP_NUM_TCP_PCB,
+               "conexoes HTTP + inscritos de /events nao cabem em MEMP_NUM_TCP_PCB");
+_Static_assert(HTTP_SERVER_RESPONSE_MAX <= TCP_SND_BUF, "HTTP_SERVER_RESPONSE_MAX > TCP_SND_BUF");
+_Static_assert(HTTP_SERVER_PENDING_MAX <= TCP_WND, "HTTP_SERVER_PENDING_MAX > TCP_WND");
+_Static_assert(HTTP_PAGE_NOT_MODIFIED_SEGMENTS <= HTTP_RESPONSE_SEGMENTS, "304 nao cabe em http_response_t");
+
+/* Heap do lwIP (MEM_SIZE). Com LWIP_NETIF_TX_SINGLE_PBUF cada pbuf da fila de
+   envio é um bloco do heap do tamanho do MSS (mem + pbuf + cabeçalhos +
+   dados), e as escritas com TCP_WRITE_FLAG_MORE enchem o anterior, então a
+   maior resposta ocupa RESPONSE_PBUFS deles. Conexão HTTP: até
+   HTTP_SERVER_SEND_PBUFS (conn_can_send); inscrito de /events: até
+   HTTP_EVENTS_MAX_QUEUED; o 503: um. Mais o pbuf só de cabeçalhos do FIN de
+   cada pcb. */
+#define SEND_PBUF_HEAP (LWIP_MEM_ALIGN_SIZE(5) + LWIP_MEM_ALIGN_SIZE(16 + PBUF_LINK_ENCAPSULATION_HLEN + PBUF_LINK_HLEN + 40) + \
+                        LWIP_MEM_ALIGN_SIZE(TCP_MSS))
+#define FIN_PBUF_HEAP  (LWIP_MEM_ALIGN_SIZE(5) + LWIP_MEM_ALIGN_SIZE(16 + PBUF_LINK_ENCAPSULATION_HLEN + PBUF_LINK_HLEN + 40))
+#define RESPONSE_PBUFS ((HTTP_SERVER_RESPONSE_MAX + TCP_MSS - 1) / TCP_MSS)
+_Static_assert(RESPONSE_PBUFS <= HTTP_SERVER_SEND_PBUFS, "HTTP_SERVER_SEND_PBUFS nao comporta a maior resposta");
+_Static_assert((HTTP_SERVER_MAX_CONNECTIONS * HTTP_SERVER_SEND_PBUFS +
+                HTTP_EVENTS_MAX_SUBSCRIBERS * HTTP_EVENTS_MAX_QUEUED + 1) * SEND_PBUF_HEAP +
+               MEMP_NUM_TCP_PCB * FIN_PBUF_HEAP <= MEM_SIZE,
+               "MEM_SIZE nao comporta a fila de envio de todos os pcbs");
+
+// Estado de uma conexão, passado pelo tcp_arg
+typedef struct {
+    struct tcp_pcb *pcb;       // NULL: vaga livre
+    struct pbuf *pending;      // recebido e ainda não lido (os pbufs do lwIP, sem cópia)
+    uint8_t idle_polls;
+    bool waiting;              // requisição lida esperando espaço na fila de envio
+    bool closing;              // não trata mais nada; fecha quando o que foi escrito for confirmado
+    bool eof;                  // o cliente fechou: responde o que já chegou e fecha
+    http_parser_t parser;      // requisição atual, lida aos pedaços
+} http_conn_t;
+
+static http_conn_t conns[HTTP_SERVER_MAX_CONNECTIONS];
+static http_page_cache_t page_cache;
+static http_router_t router;
+static http_server_change_fn change_fn;
+
+/* ─── RESPOSTAS FIXAS (FLASH) ──────────────────────────────────────── */
+static const char resp_busy[] =
+    "HTTP/1.1 503 Service Unavailable\r\nRetry-After: 1\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+static const char resp_bad_request[] =
+    "HTTP/1.1 400 Bad Request\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+// Por http_limit_t
+static const char *const resp_too_large[] = {
+    [HTTP_LIMIT_HEAD] = "HTTP/1.1 431 Request Header Fields Too Large\r\nContent-Length: 0\r\nConnection: close\r\n\r\n",
+    [HTTP_LIMIT_URI]  = "HTTP/1.1 414 URI Too Long\r\nContent-Length: 0\r\nConnection: close\r\n\r\n",
+    [HTTP_LIMIT_BODY] = "HTTP/1.1 413 Content Too Large\r\nContent-Length: 0\r\nConnection: close\r\n\r\n",
+};
+static const char resp_method[] =
+    "HTTP/1.1 405 Method Not Allowed\r\nAllow: GET\r\nContent-Length: 0\r\n\r\n";
+
+/* ─── RESPOSTAS ────────────────────────────────────────────────────── */
+// Envia a resposta em segmentos. Os gerados pedem TCP_WRITE_FLAG_COPY (o buffer
+// é reaproveitado); com LWIP_NETIF_TX_SINGLE_PBUF o lwIP copia os da flash também
+static err_t send_segments(struct tcp_pcb *tpcb, const http_segment_t *seg, size_t nseg) {
+    err_t write_err = nseg ? ERR_OK : ERR_BUF;
+    for (size_t i = 0; i < nseg && write_err == ERR_OK; i++) {
+        u8_t flags = seg[i].copy ? TCP_WRITE_FLAG_COPY : 0;
+        if (i + 1 < nseg)
+            flags |= TCP_WRITE_FLAG_MORE;   // PSH só no último segmento
+        write_err = tcp_write(tpcb, seg[i].data, seg[i].len, flags);
+    }
+    return write_err;
+}
+
+/* ─── CONEXÕES ─────────────────────────────────────────────────────── */
+static void conn_release(http_conn_t *c) {
+    if (c->pending)
+        pbuf_free(c->pending);
+    c->pending = NULL;
+    c->pcb = NULL;
+}
+
+// Descarta o que foi recebido e não lido, devolvendo a janela ao cliente
+static void conn_discard(http_conn_t *c) {
+    if (c->pending) {
+        tcp_recved(c->pcb, c->pending->tot_len);
+        pbuf_free(c->pending);
+        c->pending = NULL;
+    }
+}
+
+// Fecha a conexão e libera a vaga. Retorna ERR_ABRT se precisou abortar.
+static err_t conn_close(http_conn_t *c) {
+    struct tcp_pcb *pcb = c->pcb;
+    tcp_arg(pcb, NULL);
+    tcp_recv(pcb, NULL);
+    tcp_sent(pcb, NULL);
+    tcp_err(pcb, NULL);
+    tcp_poll(pcb, NULL, 0);
+    conn_release(c);
+    if (tcp_close(pcb) != ERR_OK) {
+        tcp_abort(pcb);
+        return ERR_ABRT;
+    }
+    return ERR_OK;
+}
+
+// Fecha quando tudo o que foi escrito já foi confirmado pelo cliente
+static err_t conn_finish(http_conn_t *c) {
+    if (c->closing && tcp_sndqueuelen(c->pcb) == 0)
+        return conn_close(c);
+    return ERR_OK;
+}
+
+// Resposta fixa de erro; a conexão fecha depois dela
+static void conn_fail(http_conn_t *c, const char *resp, size_t len) {
+    tcp_write(c->pcb, resp, (u16_t)len, 0);
+    c->closing = true;
+    conn_discard(c);
+}
+
+// Espaço para a maior resposta, em bytes, em pbufs e na parte do heap da conexão
+static bool conn_can_send(struct tcp_pcb *pcb) {
+    return tcp_sndbuf(pcb) >= HTTP_SERVER_RESPONSE_MAX &&
+           tcp_sndqueuelen(pcb) + HTTP_PAGE_SEGMENTS <= TCP_SND_QUEUELEN &&
+           tcp_sndqueuelen(pcb) + RESPONSE_PBUFS <= HTTP_SERVER_SEND_PBUFS;
+}
+
+/* ─── ROTAS ────────────────────────────────────────────────────────── */
+// Página HTML gerada no servidor, sem JavaScript: GET com a query do formulário (?floor=N&action=...&value=N)
+static void route_page(const http_request_t *r, int id, void *conn, http_response_t *res) {
+    (void)id;
+    (void)conn;
+    // parâmetros já decodificados pelo http_parser
+    const char *floor_str = http_param(r, "floor");
+    const char *token = http_param(r, "action");
+    const char *value_str = http_param(r, "value");
+    int floor = floor_str ? atoi(floor_str) : 0;
+    occupancy_action_t action = token ? occupancy_action(token) : OCCUPANCY_INVALID;
+    if (floor_str && floor_str[0] != '\0' && action != OCCUPANCY_CLEAR_ALL) {
+        occupancy_select(floor);
+    }
+    if (token && token[0] != '\0') {
+        occupancy_do(action, floor, value_str ? atoi(value_str) : 0);
+    }
+
+    // Texto fixo vem da flash; as partes geradas vêm do cache (refeitas só
+    // quando occupancy_version muda)
+    res->seg = http_page_get(&page_cache, &res->count, occupancy_version, occupancy, NUM_FLOORS, selected_floor);
+    // Navegador já tem esta versão: responde só o 304 com a ETag
+    if (r->if_none_match_len && http_page_etag_matches(&page_cache, r->if_none_match, r->if_none_match_len)) {
+        res->count = http_page_not_modified(&page_cache, res->local);
+        res->seg = res->local;
+    }
+}
+
+/* Interface web estática (web/index.html, gzip, da flash). Com query é o
+   formulário antigo (/?floor=N&action=add, usado também por integrações):
+   vai para a página gerada. */
+static void route_index(const http_request_t *r, int id, void *conn, http_response_t *res) {
+    if (r->param_count)
+        route_page(r, id, conn, res);
+    else
+        http_asset_respond(http_asset_find("/"), r, res);
+}
+
+// A conexão passa para http_events.c e fica aberta; o que mais chegou é descartado
+static void route_events(const http_request_t *r, int id, void *conn, http_response_t *res) {
+    (void)r;
+    (void)id;
+    http_conn_t *c = conn;
+    struct tcp_pcb *pcb = c->pcb;
+    conn_discard(c);
+    if (http_events_subscribe(pcb)) {
+        conn_release(c);
+        res->detached = true;
+        return;
+    }
+    res->count = http_events_busy(res->local);
+    res->close = true;
+}
+
+static void route_not_allowed(const http_request_t *r, int id, void *conn, http_response_t *res) {
+    (void)r;
+    (void)id;
+    (void)conn;
+    http_response_fixed(res, resp_method, sizeof(resp_method) - 1);
+}
+
+/* Caminho sem rota: 404 em JSON dentro da API; fora dela, GET recebe a
+   interface (o portal cativo do AP pede caminhos quaisquer) */
+static void route_other(const http_request_t *r, int id, void *conn, http_response_t *res) {
+    if (http_api_match(r->path))
+        http_api_not_found(r, id, conn, res);
+    else if (r->method == HTTP_METHOD_GET)
+        route_index(r, id, conn, res);
+    else
+        route_not_allowed(r, id, conn, res);
+}
+
+/* Rotas do servidor. Um endpoint novo é uma linha aqui (caminho e handler
+   por método); nem o parser nem o despacho mudam. */
+static const http_route_t routes[] = {
+    { "/",        { [HTTP_METHOD_OTHER] = route_not_allowed, [HTTP_METHOD_GET] = route_index } },
+    { "/app.css", { [HTTP_METHOD_OTHER] = route_not_allowed, [HTTP_METHOD_GET] = http_assets_get } },
+    { "/app.js",  { [HTTP_METHOD_OTHER] = route_not_allowed, [HTTP_METHOD_GET] = http_assets_get } },
+    { "/form",    { [HTTP_METHOD_OTHER] = route_not_allowed, [HTTP_METHOD_GET] = route_page } },
+    { "/events",  { [HTTP_METHOD_OTHER] = route_not_allowed, [HTTP_METHOD_GET] = route_events } },
+    HTTP_API_ROUTES,
+};
+_Static_assert(sizeof(routes) / sizeof(routes[0]) <= HTTP_ROUTER_SLOTS / 2, "rotas demais para HTTP_ROUTER_SLOTS");
+
+static const http_route_t route_fallback = {
+    NULL, { [HTTP_METHOD_OTHER] = route_other, [HTTP_METHOD_GET] = route_other, [HTTP_METHOD_POST] = route_other }
+};
+
+/* Responde uma requisição. Retorna false se a conexão passou para
+   http_events.c (a vaga já foi liberada). */
+static bool conn_handle(http_conn_t *c, const http_request_t *r) {
+    uint32_t version = occupancy_version;
+    http_response_t res;
+    res.close = r->close;
+    http_router_dispatch(&router, r, c, &res);
+    if (res.detached)
+        return false;
+
+    if (occupancy_version != version) {
+        if (change_fn)
+            change_fn();
+        http_events_publish();
+    }
+
+    // Resposta cortada ao meio não tem conserto: fecha
+    if (send_segments(c->pcb, res.seg, res.count) != ERR_OK)
+        res.close = true;
+    if (res.close) {
+        c->closing = true;
+        conn_discard(c);
+    }
+    return true;
+}
+
+// Lê o primeiro pbuf da cadeia direto do payload; libera o que foi lido
+static void conn_feed(http_conn_t *c) {
+    struct pbuf *q = c->pending;
+    u16_t used = (u16_t)http_parser_feed(&c->parser, q->payload, q->len);
+    tcp_recved(c->pcb, used);
+    if (used < q->len) {
+        pbuf_remove_header(q, used);   // o resto é da próxima requisição (pipelining)
+        return;
+    }
+    c->pending = q->next;
+    q->next = NULL;
+    pbuf_free(q);
+}
+
+// Lê e responde, em ordem, as requisições que estão nos pbufs recebidos
+static err_t conn_process(http_conn_t *c) {
+    c->waiting = false;
+    while (!c->closing) {
+        http_parse_status_t status = http_parser_status(&c->parser);
+        if (status == HTTP_PARSE_INCOMPLETE) {
+            if (!c->pending) {
+                c->closing = c->eof;
+                break;
+            }
+            conn_feed(c);
+            continue;
+        }
+        if (status == HTTP_PARSE_TOO_LARGE) {
+            const char *resp = resp_too_large[c->parser.limit];
+            conn_fail(c, resp, strlen(resp));
+            break;
+        }
+        if (status == HTTP_PARSE_BAD_REQUEST) {
+            conn_fail(c, resp_bad_request, sizeof(resp_bad_request) - 1);
+            break;
+        }
+        // Sem espaço para a resposta: continua no próximo tcp_sent
+        if (!conn_can_send(c->pcb)) {
+            c->waiting = true;
+            break;
+        }
+        if (!conn_handle(c, &c->parser.req))
+            return ERR_OK;
+        http_parser_init(&c->parser);
+    }
+    tcp_output(c->pcb);
+    return conn_finish(c);
+}
+
+/* ─── CALLBACKS DO LWIP ────────────────────────────────────────────── */
+static err_t conn_recv(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t err) {
+    http_conn_t *c = arg;
+    if (p == NULL) {   // cliente fechou: o que ficou nos pbufs ainda é respondido
+        c->eof = true;
+        return conn_process(c);
+    }
+    if (err != ERR_OK) {
+        pbuf_free(p);
+        return err;
+    }
+    if (c->closing) {
+        tcp_recved(pcb, p->tot_len);
+        pbuf_free(p);
+        return ERR_OK;
+    }
+    // Os pbufs ficam com a conexão até serem lidos: só se acumulam enquanto
+    // ela espera espaço no envio, e até o limite; depois o lwIP entrega de novo
+    if (c->pending) {
+        if (c->pending->tot_len + p->tot_len > HTTP_SERVER_PENDING_MAX)
+            return ERR_MEM;
+        pbuf_cat(c->pending, p);
+    } else {
+        c->pending = p;
+    }
+    c->idle_polls = 0;
+    return conn_process(c);
+}
+
+static err_t conn_sent(void *arg, struct tcp_pcb *pcb, u16_t len) {
+    http_conn_t *c = arg;
+    c->idle_polls = 0;
+    if (c->waiting)
+        return conn_process(c);
+    return conn_finish(c);
+}
+
+// A cada segundo: fecha conexões paradas; aborta as que nem assim fecham
+static err_t conn_poll(void *arg, struct tcp_pcb *pcb) {
+    http_conn_t *c = arg;
+    if (++c->idle_polls < HTTP_SERVER_IDLE_SECONDS)
+        return c->waiting ? conn_process(c) : ERR_OK;
+    if (c->closing) {
+        conn_release(c);
+        tcp_abort(pcb);
+        return ERR_ABRT;
+    }
+    c->closing = true;
+    c->idle_polls = 0;
+    return conn_finish(c);
+}
+
+// O lwIP já liberou o pcb (RST ou erro)
+static void conn_err(void *arg, err_t err) {
+    conn_release(arg);
+}
+
+static err_t conn_accept(void *arg, struct tcp_pcb *pcb, err_t err) {
+    if (err != ERR_OK || pcb == NULL)
+        return ERR_VAL;
+
+    http_conn_t *c = NULL;
+    for (int i = 0; i < HTTP_SERVER_MAX_CONNECTIONS; i++) {
+        if (!conns[i].pcb) {
+            c = &conns[i];
+            break;
+        }
+    }
+    if (!c) {
+        // Pool cheio: 503 e fecha, sem ocupar vaga
+        tcp_write(pcb, resp_busy, sizeof(resp_busy) - 1, 0);
+        tcp_output(pcb);
+        if (tcp_close(pcb) != ERR_OK) {
+            tcp_abort(pcb);
+            return ERR_ABRT;
+        }
+        return ERR_OK;
+    }
+
+    c->pcb = pcb;
+    c->pending = NULL;
+    http_parser_init(&c->parser);
+    c->idle_polls = 0;
+    c->waiting = false;
+    c->closing = false;
+    c->eof = false;
+    tcp_arg(pcb, c);
+    tcp_recv(pcb, conn_recv);
+    tcp_sent(pcb, conn_sent);
+    tcp_err(pcb, conn_err);
+    tcp_poll(pcb, conn_poll, POLL_INTERVAL);
+    return ERR_OK;
+}
+
+bool http_server_start(uint16_t port, http_server_change_fn on_change) {
+    change_fn = on_change;
+    http_page_cache_init(&page_cache);
+    if (!http_router_init(&router, routes, sizeof(routes) / sizeof(routes[0]), &route_fallback)) {
+        printf("Erro na tabela de rotas\n");
+        return false;
+    }
+
+    struct tcp_pcb *pcb = tcp_new_ip_type(IPADDR_TYPE_ANY);
+    if (!pcb) {
+        printf("Erro ao criar PCB\n");
+        return false;
+    }
+    if (tcp_bind(pcb, IP_ANY_TYPE, port) != ERR_OK) {
+        printf("Erro ao ligar o servidor na porta %d\n", port);
+        tcp_close(pcb);
+        return false;
+    }
+    pcb = tcp_listen(pcb);
+    if (!pcb) {
+        printf("Erro ao escutar na porta %d\n", port);
+        return false;
+    }
+    tcp_accept(pcb, conn_accept);
+    printf("Servidor HTTP rodando na porta %d...\n", port);
+    return true;
+}
@@ -0,0 +1,58 @@
+/**
+ * Servidor HTTP/1.1 do checkin sobre a API raw do lwIP.
+ *
+ * Conexões persistentes (keep-alive) com pipelining: cada conexão aceita tem
+ * uma vaga num pool fixo (http_conn_t, passada por tcp_arg). Os pbufs
+ * recebidos não são copiados: o http_parser lê cada um direto do payload e
+ * ele é liberado assim que lido. As requisições são respondidas em ordem,
+ * enquanto houver espaço na fila de envio do pcb; o que chegou depois fica
+ * nos pbufs e espera o próximo tcp_sent. Conexões paradas são fechadas pelo
+ * tcp_poll. Com o pool cheio, a conexão nova recebe um 503 e é fechada,
+ * sem alocar nada.
+ *
+ * Rotas: GET /, /app.css e /app.js (interface estática com gzip,
+ * http_assets.c), GET /form e GET /?... (página gerada, http_page.c),
+ * /api/floors (JSON, http_api.c) e GET /events (Server-Sent Events,
+ * http_events.c).
+ */
+#ifndef HTTP_SERVER_H
+#define HTTP_SERVER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Conexões HTTP simultâneas (fora as de /events, que têm vagas próprias)
+#ifndef HTTP_SERVER_MAX_CONNECTIONS
+#define HTTP_SERVER_MAX_CONNECTIONS 4
+#endif
+
+/* Bytes recebidos e guardados em pbufs, por conexão, enquanto ela espera
+   espaço no envio (um segmento TCP inteiro cabe); além disso o lwIP segura
+   os dados e a janela do cliente fecha */
+#ifndef HTTP_SERVER_PENDING_MAX
+#define HTTP_SERVER_PENDING_MAX 1460
+#endif
+
+// Segundos sem receber nada até fechar uma conexão persistente
+#ifndef HTTP_SERVER_IDLE_SECONDS
+#define HTTP_SERVER_IDLE_SECONDS 5
+#endif
+
+/* Maior resposta; só se começa a tratar uma requisição com esse espaço livre
+   no envio. A maior é o app.js sem gzip (http_assets.c confere). */
+#define HTTP_SERVER_RESPONSE_MAX 4096
+
+/* pbufs na fila de envio de uma conexão, cada um um bloco do heap do lwIP
+   (ver http_server.c): só se começa uma resposta se a maior ainda couber */
+#ifndef HTTP_SERVER_SEND_PBUFS
+#define HTTP_SERVER_SEND_PBUFS 4
+#endif
+
+/* Chamada (no contexto do lwIP) depois de cada requisição que mudou o
+   estado, para atualizar LEDs e OLED */
+typedef void (*http_server_change_fn)(void);
+
+// Abre a porta e passa a aceitar conexões. Retorna false em caso de erro.
+bool http_server_start(uint16_t port, http_server_change_fn on_change);
+
+#endif
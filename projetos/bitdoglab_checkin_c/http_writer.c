@@ -0,0 +1,61 @@
+/**
+ * Escrita sequencial num buffer de tamanho fixo (ver http_writer.h).
+ */
+#include "http_writer.h"
+
+#include <string.h>
+
+void http_writer_init(http_writer_t *w, char *buf, size_t len) {
+    w->pos = buf;
+    w->end = buf + len;
+    w->overflow = false;
+}
+
+void http_put_mem(http_writer_t *w, const char *s, size_t n) {
+    if (n > (size_t)(w->end - w->pos)) {
+        w->overflow = true;
+        return;
+    }
+    memcpy(w->pos, s, n);
+    w->pos += n;
+}
+
+void http_put_str(http_writer_t *w, const char *s) {
+    http_put_mem(w, s, strlen(s));
+}
+
+static void put_digits(http_writer_t *w, uint32_t u, bool negative) {
+    char digits[11];
+    char *d = digits + sizeof(digits);
+    do {
+        *--d = (char)('0' + u % 10);
+        u /= 10;
+    } while (u);
+    if (negative)
+        *--d = '-';
+    http_put_mem(w, d, (size_t)(digits + sizeof(digits) - d));
+}
+
+void http_put_int(http_writer_t *w, int value) {
+    put_digits(w, (value < 0) ? 0u - (uint32_t)value : (uint32_t)value, value < 0);
+}
+
+void http_put_uint(http_writer_t *w, uint32_t value) {
+    put_digits(w, value, false);
+}
+
+void http_put_hex32(http_writer_t *w, uint32_t value) {
+    static const char hex[] = "0123456789abcdef";
+    char digits[8];
+    for (int i = 7; i >= 0; i--) {
+        digits[i] = hex[value & 0xf];
+        value >>= 4;
+    }
+    http_put_mem(w, digits, sizeof(digits));
+}
+
+void http_segment_set(http_segment_t *seg, const char *data, size_t len, bool copy) {
+    seg->data = data;
+    seg->len = (uint16_t)len;
+    seg->copy = copy;
+}
@@ -0,0 +1,36 @@
+/**
+ * Escrita sequencial de texto num buffer de tamanho fixo, numa passada só,
+ * sem strcat/snprintf. Passar do fim não escreve nada e só marca overflow,
+ * então basta conferir uma vez no final. As respostas são listas de
+ * segmentos: texto constante (flash) ou trechos do buffer.
+ */
+#ifndef HTTP_WRITER_H
+#define HTTP_WRITER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Um pedaço da resposta, enviado com um tcp_write
+typedef struct {
+    const char *data;
+    uint16_t len;
+    bool copy;       // true: aponta para um buffer temporário, o lwIP precisa copiar
+} http_segment_t;
+
+typedef struct {
+    char *pos;
+    char *end;
+    bool overflow;
+} http_writer_t;
+
+void http_writer_init(http_writer_t *w, char *buf, size_t len);
+void http_put_mem(http_writer_t *w, const char *s, size_t n);
+void http_put_str(http_writer_t *w, const char *s);
+void http_put_int(http_writer_t *w, int value);
+void http_put_uint(http_writer_t *w, uint32_t value);
+void http_put_hex32(http_writer_t *w, uint32_t value);   // sempre 8 dígitos
+
+void http_segment_set(http_segment_t *seg, const char *data, size_t len, bool copy);
+
+#endif
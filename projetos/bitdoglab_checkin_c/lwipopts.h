@@ -19,8 +19,12 @@
 #define MEM_LIBC_MALLOC             0
 #endif
 #define MEM_ALIGNMENT               4
-#define MEM_SIZE                    4000
+// Fila de envio de todos os pcbs no pior caso, com folga para ARP/DHCP/DNS
+// (a conta está em http_server.c)
+#define MEM_SIZE                    48000
 #define MEMP_NUM_TCP_SEG            32
+// 4 conexões HTTP + 3 de /events + 1 para recusar com 503 (ver http_server.c)
+#define MEMP_NUM_TCP_PCB            8
 #define MEMP_NUM_ARP_QUEUE          10
 #define PBUF_POOL_SIZE              24
 #define LWIP_ARP                    1
@@ -47,6 +51,8 @@
 #define LWIP_UDP                    1
 #define LWIP_DNS                    1
 #define LWIP_TCP_KEEPALIVE          1
+// Cada segmento TCP num pbuf só (o driver CYW43 manda um buffer contínuo por
+// SPI): o tcp_write copia tudo para o heap, mesmo sem TCP_WRITE_FLAG_COPY
 #define LWIP_NETIF_TX_SINGLE_PBUF   1
 #define DHCP_DOES_ARP_CHECK         0
 #define LWIP_DHCP_DOES_ACD_CHECK    0
@@ -0,0 +1,157 @@
+/**
+ * Estado da ocupação do prédio (ver occupancy.h).
+ */
+#include "occupancy.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+int occupancy[NUM_FLOORS] = {0, 0, 0, 0, 0};
+int selected_floor = 0;
+volatile uint32_t occupancy_version = 0;
+
+static void occupancy_changed(void) {
+    occupancy_version++;
+}
+
+void occupancy_init(uint32_t seed) {
+    memset(occupancy, 0, sizeof(occupancy));
+    selected_floor = 0;
+    occupancy_version = seed;
+}
+
+bool occupancy_select(int floor) {
+    if (floor < 0 || floor >= NUM_FLOORS || floor == selected_floor)
+        return false;
+    selected_floor = floor;
+    occupancy_changed();
+    return true;
+}
+
+static bool occupancy_set(int floor, int value) {
+    if (occupancy[floor] == value)
+        return false;
+    occupancy[floor] = value;
+    return true;
+}
+
+/* ─── AÇÕES ────────────────────────────────────────────────────────── */
+// Cada uma retorna true se mudou a ocupação
+static bool action_add(int floor, int value) {
+    (void)value;
+    return occupancy[floor] < MAX_OCCUPANCY && occupancy_set(floor, occupancy[floor] + 1);
+}
+
+static bool action_remove(int floor, int value) {
+    (void)value;
+    return occupancy[floor] > 0 && occupancy_set(floor, occupancy[floor] - 1);
+}
+
+static bool action_clear(int floor, int value) {
+    (void)value;
+    return occupancy_set(floor, 0);
+}
+
+static bool action_set(int floor, int value) {
+    return occupancy_set(floor, value);
+}
+
+static bool action_clear_all(int floor, int value) {
+    (void)floor;
+    (void)value;
+    bool changed = false;
+    for (int i = 0; i < NUM_FLOORS; i++)
+        changed |= occupancy_set(i, 0);
+    return changed;
+}
+
+typedef struct {
+    const char *token;
+    uint8_t len;
+    bool per_floor;   // precisa de um andar válido (e o seleciona)
+    bool (*apply)(int floor, int value);
+} action_def_t;
+
+static const action_def_t actions[OCCUPANCY_INVALID] = {
+    [OCCUPANCY_ADD]       = { "add",       3, true,  action_add },
+    [OCCUPANCY_REMOVE]    = { "remove",    6, true,  action_remove },
+    [OCCUPANCY_CLEAR]     = { "clear",     5, true,  action_clear },
+    [OCCUPANCY_SET]       = { "set",       3, true,  action_set },
+    [OCCUPANCY_CLEAR_ALL] = { "clear_all", 9, false, action_clear_all },
+};
+
+/* Hash perfeito para os tokens acima (tamanho e primeira letra): cada um cai
+   numa vaga diferente; o teste no PC confere. Uma ação nova precisa de uma
+   vaga livre aqui. */
+#define ACTION_HASH(len, first) ((2 * (len) + (first)) & 15)
+#define ACTION_TOKEN_MAX 9   // "clear_all"
+
+static const uint8_t action_slots[16] = {   // ação + 1; 0 = vaga livre
+    [ACTION_HASH(3, 'a')] = OCCUPANCY_ADD + 1,
+    [ACTION_HASH(6, 'r')] = OCCUPANCY_REMOVE + 1,
+    [ACTION_HASH(5, 'c')] = OCCUPANCY_CLEAR + 1,
+    [ACTION_HASH(3, 's')] = OCCUPANCY_SET + 1,
+    [ACTION_HASH(9, 'c')] = OCCUPANCY_CLEAR_ALL + 1,
+};
+
+occupancy_action_t occupancy_action(const char *token) {
+    size_t len = strlen(token);
+    if (len == 0 || len > ACTION_TOKEN_MAX)
+        return OCCUPANCY_INVALID;
+    uint8_t slot = action_slots[ACTION_HASH(len, (uint8_t)token[0])];
+    if (!slot)
+        return OCCUPANCY_INVALID;
+    const action_def_t *a = &actions[slot - 1];
+    if (a->len != len || memcmp(a->token, token, len) != 0)
+        return OCCUPANCY_INVALID;
+    return (occupancy_action_t)(slot - 1);
+}
+
+bool occupancy_do(occupancy_action_t action, int floor, int value) {
+    if (action >= OCCUPANCY_INVALID)
+        return false;
+    const action_def_t *a = &actions[action];
+    bool changed = false;
+    if (a->per_floor) {
+        if (floor < 0 || floor >= NUM_FLOORS)
+            return false;
+        changed = floor != selected_floor;
+        selected_floor = floor;
+    }
+    changed |= a->apply(floor, value);
+    if (changed)
+        occupancy_changed();
+    return true;
+}
+
+/* ─── LOTE ─────────────────────────────────────────────────────────── */
+bool occupancy_batch(const occupancy_change_t *changes, size_t count) {
+    // Calcula tudo numa cópia; o estado só muda depois de o lote inteiro valer
+    int next[NUM_FLOORS];
+    memcpy(next, occupancy, sizeof(next));
+    for (size_t i = 0; i < count; i++) {
+        const occupancy_change_t *c = &changes[i];
+        if (c->floor < 0 || c->floor >= NUM_FLOORS)
+            return false;
+        int *n = &next[c->floor];
+        if (c->absolute) {
+            if (c->value < 0)
+                return false;
+            *n = c->value;
+        } else if (c->value > 0 && *n < MAX_OCCUPANCY) {
+            *n = (c->value < MAX_OCCUPANCY - *n) ? *n + c->value : MAX_OCCUPANCY;
+        } else if (c->value < 0 && *n > 0) {
+            *n = (*n + c->value > 0) ? *n + c->value : 0;
+        }
+    }
+    if (memcmp(next, occupancy, sizeof(next)) != 0) {
+        memcpy(occupancy, next, sizeof(next));
+        occupancy_changed();
+    }
+    return true;
+}
+
+// Quando a ação for "set", usa o valor passado em value_str.
+bool occupancy_apply(const char *floor_str, const char *action, const char *value_str) {
+    return occupancy_do(occupancy_action(action), atoi(floor_str), atoi(value_str));
+}
@@ -0,0 +1,70 @@
+/**
+ * Estado da ocupação do prédio, sem dependência de hardware (compila no PC).
+ *
+ * Toda mudança que altera o que a página mostra (ocupação ou andar
+ * selecionado) incrementa occupancy_version; quem guarda algo derivado do
+ * estado (a página em cache, a ETag) só precisa comparar a versão.
+ */
+#ifndef OCCUPANCY_H
+#define OCCUPANCY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Configurações de ocupação
+#define NUM_FLOORS     5
+#define MAX_OCCUPANCY  50  // controle via botões/HTTP
+// Para a matriz: 50 pessoas = linha completa de 5 LEDs (cada LED equivale a 10 pessoas)
+
+// Ações sobre a ocupação (tokens "add", "remove", "clear", "set", "clear_all")
+typedef enum {
+    OCCUPANCY_ADD,
+    OCCUPANCY_REMOVE,
+    OCCUPANCY_CLEAR,
+    OCCUPANCY_SET,
+    OCCUPANCY_CLEAR_ALL,
+    OCCUPANCY_INVALID,
+} occupancy_action_t;
+
+// Uma mudança de um lote (occupancy_batch)
+typedef struct {
+    int floor;
+    bool absolute;   // true: value é a ocupação (set); false: value é somado (delta)
+    int value;
+} occupancy_change_t;
+
+extern int occupancy[NUM_FLOORS];
+extern int selected_floor;
+/* Nada aqui é atômico: no Pico, quem muda o estado fora dos callbacks do lwIP
+   (botões, no loop principal) precisa de cyw43_arch_lwip_begin/end. */
+extern volatile uint32_t occupancy_version;
+
+/* Zera o estado. seed é o valor inicial da versão: com um valor diferente a
+   cada boot, uma ETag guardada pelo navegador antes de reiniciar não coincide
+   por acaso com a versão nova. */
+void occupancy_init(uint32_t seed);
+
+// Seleciona o andar mostrado; ignora andares inválidos. Retorna true se mudou.
+bool occupancy_select(int floor);
+
+/* Ação do token (por hash do tamanho e da primeira letra, sem percorrer a
+   lista), ou OCCUPANCY_INVALID. */
+occupancy_action_t occupancy_action(const char *token);
+
+/* Aplica a ação ao andar floor (ignorado em clear_all), que passa a ser o
+   selecionado; value só vale para set. Retorna false, sem mudar nada, se o
+   andar ou a ação forem inválidos. */
+bool occupancy_do(occupancy_action_t action, int floor, int value);
+
+/* Aplica um lote de mudanças em ordem, de uma vez só: todas ou nenhuma, e a
+   versão muda no máximo uma vez. Um delta se comporta como add/remove
+   repetidos (para em 0 e em MAX_OCCUPANCY). O andar selecionado não muda.
+   Retorna false, sem mudar nada, se algum andar for inválido ou um valor
+   absoluto for negativo. */
+bool occupancy_batch(const occupancy_change_t *changes, size_t count);
+
+// O mesmo, com o andar, a ação e o valor em texto (formulário)
+bool occupancy_apply(const char *floor_str, const char *action, const char *value_str);
+
+#endif
@@ -0,0 +1,112 @@
+/*
+ * Teste de carga no PC da resposta da página: requisições por segundo com a
+ * página gerada a cada GET (como antes do cache) contra a página em cache por
+ * versão, e com clientes que revalidam com If-None-Match (304).
+ *
+ * Tráfego de painel: 95% GET de leitura, 5% add/remove. O "envio" copia os
+ * segmentos com copy=true (o texto gerado) num buffer; no Pico o tcp_write
+ * copia também os da flash (LWIP_NETIF_TX_SINGLE_PBUF), o mesmo custo nos
+ * três casos, que fica de fora.
+ * A pilha TCP em si não entra (ver test/load_http_server.c para isso).
+ *
+ * Compilar e rodar (a partir de projetos/bitdoglab_checkin_c):
+ *   gcc -std=c11 -O2 -I. test/bench_http_page.c occupancy.c http_page.c http_writer.c -o bench_http_page && ./bench_http_page
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "occupancy.h"
+#include "http_page.h"
+
+#define REQUESTS 2000000
+#define WRITE_PERCENT 5
+
+typedef enum { MODE_RENDER, MODE_CACHE, MODE_CACHE_ETAG } bench_mode_t;
+
+static http_page_cache_t cache;
+static char sink[2048];
+static size_t copied;
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// tcp_write: copia só o texto gerado
+static void send_segments(const http_segment_t *seg, size_t n) {
+    size_t k = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (seg[i].copy) {
+            memcpy(sink + k, seg[i].data, seg[i].len);
+            k += seg[i].len;
+        }
+    }
+    copied += k;
+}
+
+static uint32_t rng = 12345;
+static uint32_t next_rand(void) {
+    rng = rng * 1103515245u + 12345u;
+    return rng >> 16;
+}
+
+static void run(const char *name, bench_mode_t mode) {
+    static char dynamic[HTTP_PAGE_DYNAMIC];
+    http_segment_t seg[HTTP_PAGE_SEGMENTS];
+    http_segment_t nm[HTTP_PAGE_NOT_MODIFIED_SEGMENTS];
+    char if_none_match[16] = "";
+    uint32_t not_modified = 0;
+
+    occupancy_init(0);
+    http_page_cache_init(&cache);
+    copied = 0;
+    rng = 12345;
+
+    double t0 = now_ns();
+    for (int r = 0; r < REQUESTS; r++) {
+        uint32_t x = next_rand();
+        if (x % 100 < WRITE_PERCENT) {
+            char floor[2] = { (char)('0' + x % NUM_FLOORS), '\0' };
+            occupancy_apply(floor, (x & 0x100) ? "add" : "remove", "");
+        }
+
+        const http_segment_t *out;
+        size_t n;
+        if (mode == MODE_RENDER) {
+            n = http_page_render(seg, dynamic, sizeof dynamic, occupancy_version, occupancy, NUM_FLOORS, selected_floor);
+            out = seg;
+        } else {
+            out = http_page_get(&cache, &n, occupancy_version, occupancy, NUM_FLOORS, selected_floor);
+            if (mode == MODE_CACHE_ETAG) {
+                if (http_page_etag_matches(&cache, if_none_match, strlen(if_none_match))) {
+                    n = http_page_not_modified(&cache, nm);
+                    out = nm;
+                    not_modified++;
+                } else {
+                    // o cliente guarda a ETag recebida
+                    memcpy(if_none_match, out[1].data + 6, 10);
+                    if_none_match[10] = '\0';
+                }
+            }
+        }
+        send_segments(out, n);
+    }
+    double ns = (now_ns() - t0) / REQUESTS;
+
+    printf("%-26s %8.0f ns/req %10.0f req/s %6.0f B copiados/req", name, ns, 1e9 / ns, (double)copied / REQUESTS);
+    if (mode != MODE_RENDER)
+        printf("  geradas %u", cache.renders);
+    if (mode == MODE_CACHE_ETAG)
+        printf("  304: %u", not_modified);
+    printf("\n");
+}
+
+int main(void) {
+    printf("%d requisicoes, %d%% alteram o estado\n", REQUESTS, WRITE_PERCENT);
+    run("sem cache", MODE_RENDER);
+    run("cache por versao", MODE_CACHE);
+    run("cache + If-None-Match", MODE_CACHE_ETAG);
+    return 0;
+}
@@ -0,0 +1,184 @@
+/*
+ * Teste de carga no PC da leitura das requisições: a leitura anterior
+ * (pbufs copiados num buffer por conexão, fim do cabeçalho com strstr e
+ * parâmetros com strstr na linha) contra o http_parser lendo os pbufs no
+ * lugar, com a requisição num pbuf só e cortada em vários.
+ *
+ * Tráfego: requisições de navegador (cabeçalhos longos, If-None-Match),
+ * formulário com query e POST da API, em pipelining. A "cadeia de pbufs" é
+ * só um vetor de pedaços; a pilha TCP não entra.
+ *
+ * Compilar e rodar (a partir de projetos/bitdoglab_checkin_c):
+ *   gcc -std=c11 -O2 -I. test/bench_http_parser.c http_parser.c -o bench_http_parser && ./bench_http_parser
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "http_parser.h"
+
+#define ROUNDS 200000
+#define BUFFER 1460   // buffer por conexão da leitura anterior
+
+static const char traffic[] =
+    "GET / HTTP/1.1\r\nHost: 192.168.0.10\r\nConnection: keep-alive\r\n"
+    "User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/120.0 Safari/537.36\r\n"
+    "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,*/*;q=0.8\r\n"
+    "Accept-Encoding: gzip, deflate\r\nAccept-Language: pt-BR,pt;q=0.9,en;q=0.8\r\n"
+    "If-None-Match: \"1234abcd\"\r\n\r\n"
+    "GET /?floor=3&action=set&value=42 HTTP/1.1\r\nHost: 192.168.0.10\r\n"
+    "Referer: http://192.168.0.10/\r\nAccept: text/html\r\n\r\n"
+    "POST /api/floors/2 HTTP/1.1\r\nHost: 192.168.0.10\r\nContent-Type: application/x-www-form-urlencoded\r\n"
+    "Content-Length: 10\r\n\r\naction=add"
+    "GET /api/floors HTTP/1.1\r\nHost: 192.168.0.10\r\nAccept: application/json\r\n\r\n";
+#define REQUESTS_PER_ROUND 4
+
+static volatile unsigned sink;
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* ─── LEITURA ANTERIOR ─────────────────────────────────────────────── */
+static char lower(char c) {
+    return (c >= 'A' && c <= 'Z') ? (char)(c + 'a' - 'A') : c;
+}
+
+static const char *header_value(const char *line, size_t len, const char *name) {
+    size_t n = strlen(name);
+    if (len <= n || line[n] != ':')
+        return NULL;
+    for (size_t i = 0; i < n; i++)
+        if (lower(line[i]) != lower(name[i]))
+            return NULL;
+    const char *v = line + n + 1;
+    while (*v == ' ' || *v == '\t')
+        v++;
+    return v;
+}
+
+static void parse_param(const char *request_line, const char *key, char *dest, size_t dest_size) {
+    dest[0] = '\0';
+    const char *p = strstr(request_line, key);
+    if (p) {
+        p += strlen(key);
+        size_t i = 0;
+        while (*p && *p != '&' && *p != ' ' && i < dest_size - 1)
+            dest[i++] = *p++;
+        dest[i] = '\0';
+    }
+}
+
+// Tamanho da requisição no início de buf, 0 se incompleta
+static size_t legacy_request(char *buf, size_t len) {
+    char *head_end = strstr(buf, "\r\n\r\n");
+    if (!head_end)
+        return 0;
+    char *line_end = strstr(buf, "\r\n");
+    char *sp1 = memchr(buf, ' ', (size_t)(line_end - buf));
+    char *sp2 = sp1 ? memchr(sp1 + 1, ' ', (size_t)(line_end - sp1 - 1)) : NULL;
+    size_t content_length = 0, inm_len = 0;
+    for (char *h = line_end + 2; h < head_end;) {
+        char *e = strstr(h, "\r\n");
+        const char *v;
+        if ((v = header_value(h, (size_t)(e - h), "Content-Length")))
+            content_length = strtoul(v, NULL, 10);
+        else if ((v = header_value(h, (size_t)(e - h), "If-None-Match")))
+            inm_len = (size_t)(e - v);
+        h = e + 2;
+    }
+    size_t head = (size_t)(head_end + 4 - buf);
+    if (len < head + content_length)
+        return 0;
+    *sp1 = '\0';
+    *sp2 = '\0';
+    char floor_str[8], action[16], value_str[8];
+    parse_param(sp1 + 1, "floor=", floor_str, sizeof(floor_str));
+    parse_param(sp1 + 1, "action=", action, sizeof(action));
+    parse_param(sp1 + 1, "value=", value_str, sizeof(value_str));
+    sink += (unsigned)(floor_str[0] + action[0] + value_str[0] + inm_len);
+    return head + content_length;
+}
+
+// Pedaços copiados para o buffer (pbuf_copy_partial) e lidos depois de cada um
+static unsigned run_legacy(const char *text, size_t len, size_t chunk) {
+    static char buf[BUFFER + 1];
+    size_t used = 0, filled = 0;
+    unsigned requests = 0;
+    for (size_t off = 0; off < len; off += chunk) {
+        size_t n = len - off < chunk ? len - off : chunk;
+        memcpy(buf + filled, text + off, n);
+        filled += n;
+        buf[filled] = '\0';
+        size_t size;
+        while (used < filled && (size = legacy_request(buf + used, filled - used))) {
+            used += size;
+            requests++;
+        }
+        memmove(buf, buf + used, filled - used);
+        filled -= used;
+        used = 0;
+        buf[filled] = '\0';
+    }
+    return requests;
+}
+
+/* ─── HTTP_PARSER ──────────────────────────────────────────────────── */
+// Cada pedaço é lido no lugar, como o payload de um pbuf
+static unsigned run_parser(const char *text, size_t len, size_t chunk) {
+    static http_parser_t p;
+    unsigned requests = 0;
+    http_parser_init(&p);
+    for (size_t off = 0; off < len; off += chunk) {
+        const char *data = text + off;
+        size_t n = len - off < chunk ? len - off : chunk;
+        while (n) {
+            size_t used = http_parser_feed(&p, data, n);
+            data += used;
+            n -= used;
+            if (http_parser_status(&p) == HTTP_PARSE_DONE) {
+                const char *floor_str = http_param(&p.req, "floor");
+                sink += (unsigned)(p.req.path[1] + (floor_str ? floor_str[0] : 0) + p.req.if_none_match_len);
+                requests++;
+                http_parser_init(&p);
+            }
+        }
+    }
+    return requests;
+}
+
+// Melhor de 3 medidas, para tirar o ruído do escalonador
+static void run(const char *name, unsigned (*fn)(const char *, size_t, size_t), size_t chunk) {
+    size_t len = sizeof(traffic) - 1;
+    double best = 0;
+    for (int k = 0; k < 3; k++) {
+        unsigned requests = 0;
+        double t0 = now_ns();
+        for (int i = 0; i < ROUNDS; i++)
+            requests += fn(traffic, len, chunk);
+        double ns = now_ns() - t0;
+        if (requests != (unsigned)ROUNDS * REQUESTS_PER_ROUND) {
+            printf("%s: %u requisicoes, esperado %u\n", name, requests, ROUNDS * REQUESTS_PER_ROUND);
+            exit(1);
+        }
+        if (!best || ns < best)
+            best = ns;
+    }
+    printf("%-34s pbuf %4zu B  %7.1f ns/req  %6.0f MB/s\n", name, chunk, best / (ROUNDS * REQUESTS_PER_ROUND),
+           (double)len * ROUNDS / best * 1e3);
+}
+
+int main(void) {
+    printf("%zu bytes, %d requisicoes por rodada, %d rodadas\n", sizeof(traffic) - 1, REQUESTS_PER_ROUND, ROUNDS);
+    run("buffer + strstr (anterior)", run_legacy, BUFFER);
+    run("buffer + strstr (anterior)", run_legacy, 128);
+    run("http_parser no pbuf", run_parser, BUFFER);
+    run("http_parser no pbuf", run_parser, 128);
+    run("http_parser no pbuf", run_parser, 16);
+    printf("memoria por conexao: %d B de buffer (anterior) x %zu B de http_parser_t\n",
+           BUFFER + 1, sizeof(http_parser_t));
+    return 0;
+}
@@ -0,0 +1,413 @@
+/*
+ * Teste de carga no PC do servidor HTTP inteiro (http_server.c, rotas,
+ * página, API e /events) sobre o lwIP de mentira de test/lwip_host, com os
+ * limites do lwipopts.h do projeto.
+ *
+ * Clientes com keep-alive (e pipelining, em alguns cenários) repetem tráfego
+ * de painel: página estática com gzip (metade revalidando com If-None-Match),
+ * GET da API e add/remove pelo formulário e pela API. A rede é um ida e volta de RTT_MS:
+ * o que o servidor envia numa rodada o cliente lê e confirma na seguinte.
+ * Para cada cenário:
+ *   - latência de cada requisição (do pedido à resposta completa, com as
+ *     esperas por janela, pool e reconexões), p50 e p99;
+ *   - vazão na rede simulada e tempo de CPU do servidor por requisição no
+ *     PC (só os callbacks; o RP2040 é bem mais lento, compare entre si);
+ *   - picos de pcbs, segmentos, PBUF_POOL, heap e fila de envio contra o
+ *     lwipopts.h, e as falhas de memória que o lwIP teria dado.
+ * Com isso dá para mexer em MEM_SIZE, PBUF_POOL_SIZE, TCP_SND_BUF etc. no
+ * lwipopts.h e ver o efeito antes de gravar na placa. Sai com erro se algum
+ * cenário parou ou teve tcp_write/tcp_close com ERR_MEM ou RST: com o
+ * lwipopts.h do projeto nada disso pode acontecer (503 e SYN descartado com o
+ * pool cheio são esperados).
+ *
+ * Compilar e rodar (a partir de projetos/bitdoglab_checkin_c):
+ *   gcc -std=c11 -O2 -I. -Itest/lwip_host test/load_http_server.c test/lwip_host/lwip_host.c \
+ *       http_server.c http_router.c http_parser.c http_api.c http_assets.c http_page.c \
+ *       http_events.c http_writer.c occupancy.c -o load_http_server && ./load_http_server [requisicoes] [semente]
+ */
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "lwip_host.h"
+#include "http_server.h"
+#include "occupancy.h"
+
+#define PORT        80
+#define RTT_MS      10      // ida e volta pelo Wi-Fi
+#define RETRY_MS    1000    // Retry-After do 503 e retransmissão do SYN
+#define LIMIT_MS    600000  // cenário que não termina em 10 min simulados parou
+#define MAX_CLIENTS 16
+#define MAX_DEPTH   4       // requisições em pipelining por conexão
+#define REQUEST_MAX 512
+#define CLIENT_RX   16384
+
+typedef enum { REQ_PAGE, REQ_PAGE_ETAG, REQ_API_GET, REQ_FORM, REQ_API_POST } request_kind_t;
+
+typedef struct {
+    request_kind_t kind;
+    unsigned issued_ms;
+    size_t len;
+    char text[REQUEST_MAX];
+} request_t;
+
+typedef struct {
+    struct tcp_pcb *pcb;
+    bool events;                // fica em /events
+    unsigned connected_ms;      // o pedido sai na rodada seguinte ao handshake
+    unsigned retry_ms;          // sem conexão: tenta de novo a partir daqui
+    request_t req[MAX_DEPTH];   // sem resposta, em ordem
+    size_t count;
+    size_t unsent;              // bytes do fim da fila ainda não aceitos pelo servidor
+    char rx[CLIENT_RX + 1];
+    size_t rx_len;
+    char etag[64];
+    bool busy;                  // recebeu 503: reconecta depois de RETRY_MS
+    bool streaming;             // /events: cabeçalho lido, o resto é o fluxo
+    size_t line;                // /events: caracteres de "data:" no início da linha
+} client_t;
+
+typedef struct {
+    const char *name;
+    int clients;
+    int depth;
+    int subscribers;
+} scenario_t;
+
+static const scenario_t scenarios[] = {
+    { "1 cliente",                 1, 1, 0 },
+    { "4 clientes",                4, 1, 0 },
+    { "4 clientes, pipelining 4",  4, 4, 0 },
+    { "4 clientes + 3 em /events", 4, 1, 3 },
+    { "8 clientes (pool cheio)",   8, 1, 0 },
+};
+
+static client_t clients[MAX_CLIENTS];
+static unsigned now_ms;
+static unsigned *latency;
+static unsigned done, issued, quota;
+static unsigned busy, resent, events_seen, errors, failed;
+static unsigned rng_state = 1;
+static FILE *out;
+
+static unsigned rng(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+/* ─── REQUISIÇÕES ──────────────────────────────────────────────────── */
+static const char browser[] =
+    "Host: 192.168.4.1\r\n"
+    "User-Agent: Mozilla/5.0 (Linux; Android 14) AppleWebKit/537.36 Chrome/120.0 Mobile Safari/537.36\r\n"
+    "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,*/*;q=0.8\r\n"
+    "Accept-Encoding: gzip, deflate\r\nAccept-Language: pt-BR,pt;q=0.9\r\nConnection: keep-alive\r\n";
+
+// Mistura de painel: 35% página, 25% revalidação, 20% GET da API, 20% add/remove
+static void request_make(client_t *c, request_t *r) {
+    unsigned dice = rng() % 100;
+    int floor = (int)(rng() % NUM_FLOORS);
+    const char *action = rng() % 2 ? "add" : "remove";
+    int n;
+    if (dice < 35 || (dice < 60 && !c->etag[0])) {
+        r->kind = REQ_PAGE;
+        n = snprintf(r->text, sizeof(r->text), "GET / HTTP/1.1\r\n%s\r\n", browser);
+    } else if (dice < 60) {
+        r->kind = REQ_PAGE_ETAG;
+        char etag[sizeof(c->etag)];
+        memcpy(etag, c->etag, sizeof(etag));
+        n = snprintf(r->text, sizeof(r->text), "GET / HTTP/1.1\r\n%sIf-None-Match: %s\r\n\r\n", browser, etag);
+    } else if (dice < 80) {
+        r->kind = REQ_API_GET;
+        n = snprintf(r->text, sizeof(r->text),
+                     "GET /api/floors HTTP/1.1\r\nHost: 192.168.4.1\r\nAccept: application/json\r\n\r\n");
+    } else if (dice < 90) {
+        r->kind = REQ_FORM;
+        n = snprintf(r->text, sizeof(r->text), "GET /?floor=%d&action=%s HTTP/1.1\r\nReferer: http://192.168.4.1/\r\n%s\r\n",
+                     floor, action, browser);
+    } else {
+        r->kind = REQ_API_POST;
+        n = snprintf(r->text, sizeof(r->text),
+                     "POST /api/floors/%d HTTP/1.1\r\nHost: 192.168.4.1\r\n"
+                     "Content-Type: application/x-www-form-urlencoded\r\nContent-Length: %zu\r\n\r\naction=%s",
+                     floor, strlen("action=") + strlen(action), action);
+    }
+    r->len = (size_t)n;
+    r->issued_ms = now_ms;
+}
+
+// Sem resposta esperada: códigos que o tráfego acima pode receber
+static bool status_ok(request_kind_t kind, int status) {
+    return status == 200 || (kind == REQ_PAGE_ETAG && status == 304);
+}
+
+/* ─── RESPOSTAS ────────────────────────────────────────────────────── */
+static const char *header(const char *head, const char *end, const char *name) {
+    size_t n = strlen(name);
+    for (const char *p = head; p && p < end; p = strstr(p, "\r\n")) {
+        p += 2;
+        if ((size_t)(end - p) > n && strncmp(p, name, n) == 0)
+            return p + n;
+    }
+    return NULL;
+}
+
+// Tamanho da resposta completa no início de rx (0 se incompleta)
+static size_t response_size(client_t *c, int *status) {
+    char *end = strstr(c->rx, "\r\n\r\n");
+    if (!end)
+        return 0;
+    *status = atoi(c->rx + 9);
+    const char *v = header(c->rx, end, "Content-Length: ");
+    size_t size = (size_t)(end + 4 - c->rx) + (v ? strtoul(v, NULL, 10) : 0);
+    if (size > c->rx_len)
+        return 0;
+    if ((v = header(c->rx, end, "ETag: "))) {
+        size_t n = strcspn(v, "\r");
+        if (n < sizeof(c->etag)) {
+            memcpy(c->etag, v, n);
+            c->etag[n] = '\0';
+        }
+    }
+    return size;
+}
+
+static void request_done(client_t *c, int status) {
+    request_t *r = &c->req[0];
+    if (!status_ok(r->kind, status)) {
+        if (errors++ < 5)
+            fprintf(out, "resposta %d para:\n%.*s\n", status, (int)r->len, r->text);
+    }
+    latency[done++] = now_ms - r->issued_ms;
+    c->count--;
+    memmove(c->req, c->req + 1, c->count * sizeof(request_t));
+}
+
+// /events: conta as linhas "data:"
+static void events_read(client_t *c, const char *data, size_t len) {
+    static const char prefix[] = "data:";
+    for (size_t i = 0; i < len; i++) {
+        if (data[i] == '\n') {
+            c->line = 0;
+        } else if (c->line < sizeof(prefix) - 1 && data[i] == prefix[c->line]) {
+            if (++c->line == sizeof(prefix) - 1)
+                events_seen++;
+        } else {
+            c->line = sizeof(prefix);   // resto da linha
+        }
+    }
+}
+
+/* ─── CLIENTES ─────────────────────────────────────────────────────── */
+// A conexão acabou: o que não teve resposta vai de novo numa conexão nova
+static void client_drop(client_t *c, unsigned retry_ms) {
+    lwip_host_release(c->pcb);
+    c->pcb = NULL;
+    c->rx_len = 0;
+    c->busy = false;
+    c->streaming = false;
+    if (c->events)
+        c->count = 0;   // inscreve de novo ao conectar
+    c->unsent = 0;
+    for (size_t i = 0; i < c->count; i++)
+        c->unsent += c->req[i].len;
+    resent += (unsigned)c->count;
+    c->retry_ms = now_ms + retry_ms;
+}
+
+static void client_read(client_t *c) {
+    if (!c->pcb)
+        return;
+    size_t len;
+    const char *data = lwip_host_peek(c->pcb, &len);
+    if (c->streaming) {
+        events_read(c, data, len);
+    } else if (len) {
+        if (c->rx_len + len > CLIENT_RX) {
+            fprintf(out, "resposta maior que %d bytes\n", CLIENT_RX);
+            exit(1);
+        }
+        memcpy(c->rx + c->rx_len, data, len);
+        c->rx_len += len;
+        c->rx[c->rx_len] = '\0';
+        int status;
+        size_t size;
+        while ((size = response_size(c, &status))) {
+            if (status == 503) {   // pool cheio: o servidor fecha; tenta depois
+                busy++;
+                c->busy = true;
+                c->rx_len = 0;
+                break;
+            }
+            if (c->events) {
+                c->streaming = true;
+                c->count = 0;
+                events_read(c, c->rx + size, c->rx_len - size);
+                break;
+            }
+            if (!c->count) {
+                fprintf(out, "resposta sem requisicao\n");
+                exit(1);
+            }
+            request_done(c, status);
+            memmove(c->rx, c->rx + size, c->rx_len - size + 1);
+            c->rx_len -= size;
+        }
+    }
+    lwip_host_ack(c->pcb);
+
+    lwip_host_state_t state = lwip_host_state(c->pcb);
+    if (state == LWIP_HOST_EOF) {
+        lwip_host_close(c->pcb);
+        client_drop(c, c->busy ? RETRY_MS : 0);
+    } else if (state == LWIP_HOST_RESET) {
+        client_drop(c, 0);
+    }
+}
+
+static void client_write(client_t *c, int depth) {
+    if (!c->pcb) {
+        // sem nada a pedir não reconecta (não ocupa vaga de quem ainda espera resposta)
+        if (now_ms < c->retry_ms || (!c->events && !c->count && issued >= quota))
+            return;
+        c->pcb = lwip_host_connect(PORT);
+        if (!c->pcb) {   // SYN descartado
+            c->retry_ms = now_ms + RETRY_MS;
+            return;
+        }
+        c->connected_ms = now_ms;
+        c->line = 0;
+        if (c->events) {
+            request_t *r = &c->req[0];
+            r->len = (size_t)snprintf(r->text, sizeof(r->text), "GET /events HTTP/1.1\r\n%s\r\n", browser);
+            c->count = 1;
+            c->unsent = r->len;
+        }
+        return;
+    }
+    if (now_ms == c->connected_ms || lwip_host_state(c->pcb) != LWIP_HOST_OPEN)
+        return;
+    while (!c->events && (int)c->count < depth && issued < quota) {
+        request_make(c, &c->req[c->count]);
+        c->unsent += c->req[c->count].len;
+        c->count++;
+        issued++;
+    }
+    // Envia o fim da fila que o servidor ainda não aceitou
+    size_t skip = 0;
+    for (size_t i = 0; i < c->count; i++)
+        skip += c->req[i].len;
+    skip -= c->unsent;
+    for (size_t i = 0; i < c->count && c->unsent; i++) {
+        if (skip >= c->req[i].len) {
+            skip -= c->req[i].len;
+            continue;
+        }
+        size_t want = c->req[i].len - skip;
+        size_t n = lwip_host_send(c->pcb, c->req[i].text + skip, want);
+        c->unsent -= n;
+        skip = 0;
+        if (n < want)
+            break;
+    }
+}
+
+static void client_close(client_t *c) {
+    if (!c->pcb)
+        return;
+    lwip_host_close(c->pcb);
+    for (int i = 0; i < 100 && lwip_host_state(c->pcb) == LWIP_HOST_OPEN; i++) {
+        lwip_host_ack(c->pcb);
+        lwip_host_advance(RTT_MS);
+    }
+    lwip_host_release(c->pcb);
+    c->pcb = NULL;
+}
+
+/* ─── CENÁRIOS ─────────────────────────────────────────────────────── */
+static int cmp_unsigned(const void *a, const void *b) {
+    unsigned x = *(const unsigned *)a, y = *(const unsigned *)b;
+    return (x > y) - (x < y);
+}
+
+static void run(const scenario_t *sc) {
+    memset(clients, 0, sizeof(clients));
+    int total = sc->clients + sc->subscribers;
+    for (int i = sc->clients; i < total; i++)
+        clients[i].events = true;
+    done = issued = 0;
+    busy = resent = events_seen = 0;
+    now_ms = 0;
+    lwip_host_reset_stats();
+
+    while (done < quota && now_ms < LIMIT_MS) {
+        // Ordem sorteada a cada rodada: os primeiros não ficam sempre com o heap
+        int first = (int)(rng() % (unsigned)total);
+        for (int i = 0; i < total; i++)
+            client_read(&clients[(first + i) % total]);
+        for (int i = 0; i < total; i++)
+            client_write(&clients[(first + i) % total], sc->depth);
+        lwip_host_advance(RTT_MS);
+        now_ms += RTT_MS;
+    }
+    unsigned elapsed = now_ms;
+    lwip_host_stats_t st = *lwip_host_stats();
+    for (int i = 0; i < total; i++)
+        client_close(&clients[i]);
+
+    if (!done) {
+        fprintf(out, "%-28s nenhuma resposta em %u s\n", sc->name, LIMIT_MS / 1000);
+        failed++;
+        return;
+    }
+    qsort(latency, done, sizeof(unsigned), cmp_unsigned);
+    fprintf(out, "%-28s %6u req  p50 %4u ms  p99 %5u ms  %6.0f req/s  CPU %5.2f us/req%s\n", sc->name, done,
+            latency[done / 2], latency[(size_t)done * 99 / 100], done * 1000.0 / elapsed,
+            st.callback_ns / done / 1e3, done < quota ? "  (parou)" : "");
+    fprintf(out, "    picos: pcb %u/%d  seg %u/%d  PBUF_POOL %u/%d  PBUF(ROM) %u/%d  heap %u/%d  fila %u/%d  envio %u/%d\n",
+            st.max.pcb, MEMP_NUM_TCP_PCB, st.max.seg, MEMP_NUM_TCP_SEG, st.max.pbuf_pool, PBUF_POOL_SIZE,
+            st.max.pbuf_rom, MEMP_NUM_PBUF, st.max.heap, MEM_SIZE, st.max.snd_queuelen, TCP_SND_QUEUELEN,
+            st.max.snd_bytes, TCP_SND_BUF);
+    fprintf(out, "    falhas: tcp_write ERR_MEM %u  tcp_close ERR_MEM %u  RST %u  recusados %u  "
+            "pacotes descartados %u  SYN descartados %u  503 %u  reenvios %u",
+            st.write_mem, st.close_mem, st.resets, st.rx_refused, st.rx_dropped, st.syn_dropped, busy, resent);
+    if (sc->subscribers)
+        fprintf(out, "  eventos %u", events_seen);
+    fprintf(out, "\n");
+    if (done < quota || st.write_mem || st.close_mem || st.resets)
+        failed++;
+}
+
+int main(int argc, char **argv) {
+    quota = argc > 1 ? (unsigned)strtoul(argv[1], NULL, 10) : 20000;
+    rng_state = argc > 2 ? (unsigned)strtoul(argv[2], NULL, 10) : 1;
+    if (!quota || !rng_state || quota > 10000000) {
+        fprintf(stderr, "uso: %s [requisicoes] [semente]\n", argv[0]);
+        return 1;
+    }
+    latency = malloc(quota * sizeof(unsigned));
+    if (!latency)
+        return 1;
+
+    // As mensagens do servidor (printf) iriam para o meio da tabela; as falhas já são contadas
+    out = fdopen(dup(STDOUT_FILENO), "w");
+    if (!out || !freopen("/dev/null", "w", stdout))
+        return 1;
+
+    occupancy_init(1);
+    if (!http_server_start(PORT, NULL)) {
+        fprintf(out, "http_server_start falhou\n");
+        return 1;
+    }
+    fprintf(out, "%u requisicoes por cenario, RTT %d ms, MSS %d, lwipopts.h: MEM_SIZE %d, PBUF_POOL_SIZE %d, "
+            "TCP_SND_BUF %d, TCP_WND %d\n", quota, RTT_MS, TCP_MSS, MEM_SIZE, PBUF_POOL_SIZE, TCP_SND_BUF, TCP_WND);
+    for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++)
+        run(&scenarios[i]);
+    if (errors)
+        fprintf(out, "%u respostas inesperadas\n", errors);
+    if (failed)
+        fprintf(out, "%u cenario(s) parados ou com ERR_MEM/RST\n", failed);
+    return errors || failed;
+}
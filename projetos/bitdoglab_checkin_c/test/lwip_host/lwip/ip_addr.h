@@ -0,0 +1,18 @@
+/* Endereços IP do lwIP para o shim do PC (só o "qualquer endereço"). */
+#ifndef LWIP_HOST_IP_ADDR_H
+#define LWIP_HOST_IP_ADDR_H
+
+#include "lwip/arch.h"
+
+typedef struct {
+    u32_t addr;
+} ip_addr_t;
+
+#define IPADDR_TYPE_V4  0U
+#define IPADDR_TYPE_V6  6U
+#define IPADDR_TYPE_ANY 46U
+
+extern const ip_addr_t ip_addr_any;
+#define IP_ANY_TYPE (&ip_addr_any)
+
+#endif
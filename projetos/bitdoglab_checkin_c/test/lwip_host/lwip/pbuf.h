@@ -0,0 +1,24 @@
+/* pbufs do lwIP para o shim do PC: só os do PBUF_POOL, que chegam no tcp_recv. */
+#ifndef LWIP_HOST_PBUF_H
+#define LWIP_HOST_PBUF_H
+
+#include "lwip/arch.h"
+#include "lwip/opt.h"
+
+struct pbuf {
+    struct pbuf *next;
+    void *payload;
+    u16_t tot_len;
+    u16_t len;
+    u8_t type_internal;
+    u8_t flags;
+    u8_t ref;
+    u8_t if_idx;
+};
+
+u8_t pbuf_free(struct pbuf *p);
+void pbuf_cat(struct pbuf *head, struct pbuf *tail);
+u8_t pbuf_remove_header(struct pbuf *p, size_t header_size);
+u16_t pbuf_clen(const struct pbuf *p);
+
+#endif
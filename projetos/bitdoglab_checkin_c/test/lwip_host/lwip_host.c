@@ -0,0 +1,763 @@
+/*
+ * lwIP de mentira para rodar o servidor HTTP no PC (ver lwip_host.h).
+ */
+#define _POSIX_C_SOURCE 199309L
+#include "lwip_host.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Cabeçalhos na frente dos dados de um pbuf PBUF_TRANSPORT (Ethernet, IP, TCP)
+#define PBUF_TRANSPORT_HLEN (PBUF_LINK_ENCAPSULATION_HLEN + PBUF_LINK_HLEN + 20 + 20)
+#define PBUF_RAW_HLEN       0
+
+// Num ARM de 32 bits: struct pbuf e o cabeçalho de um bloco do heap (MEM_SIZE < 64 KB)
+#define SIZEOF_STRUCT_PBUF 16
+#define SIZEOF_STRUCT_MEM  LWIP_MEM_ALIGN_SIZE(5)
+#define MEM_MIN_SIZE       LWIP_MEM_ALIGN_SIZE(12)
+
+// LWIP_TCP_CALC_INITIAL_CWND
+#define INITIAL_CWND (TCP_MSS * 4 < 4380 ? TCP_MSS * 4 : (TCP_MSS * 2 > 4380 ? TCP_MSS * 2 : 4380))
+
+// Conexões acompanhadas ao mesmo tempo (as do servidor e as que o cliente ainda não largou)
+#define MAX_PCBS 64
+
+// Um segmento na fila de envio de um pcb
+typedef struct {
+    u16_t len;      // bytes de dados
+    u16_t room;     // espaço livre no pbuf copiado (oversize); só o do último não enviado é usado
+    u16_t heap;     // bytes tirados do heap
+    u8_t pbufs;     // entra em TCP_SND_QUEUELEN
+    u8_t rom;       // pbufs PBUF_ROM (MEMP_NUM_PBUF)
+    bool fin;
+} seg_t;
+
+struct tcp_pcb {
+    void *callback_arg;
+    tcp_accept_fn accept;
+    tcp_recv_fn recv;
+    tcp_sent_fn sent;
+    tcp_poll_fn poll;
+    tcp_err_fn errf;
+    u8_t pollinterval;
+    u8_t polltmr;
+    u16_t port;
+
+    bool listening;
+    bool active;         // ocupa uma vaga de MEMP_NUM_TCP_PCB
+    bool closed;         // tcp_close: FIN na fila
+    bool fin_sent;
+    bool reset;
+    bool aborted;        // tcp_abort: o callback que abortou precisa retornar ERR_ABRT
+    bool remote_fin;     // o cliente fechou
+    bool fin_pending;    // FIN do cliente esperando os dados recusados
+    bool nagle_memerr;   // TF_NAGLEMEMERR: tcp_write falhou, envia sem esperar
+
+    // segs[0, nsent): enviados e não confirmados; segs[nsent, nseg): não enviados
+    seg_t segs[TCP_SND_QUEUELEN + 1];
+    size_t nseg, nsent;
+    u16_t snd_buf;
+    u16_t snd_queuelen;
+    u32_t cwnd, ssthresh, bytes_acked;
+    // escritos e não confirmados: [0, tx_read) lidos, [tx_read, tx_sent) enviados, até tx_len escritos
+    char tx[TCP_SND_BUF];
+    size_t tx_len, tx_sent, tx_read;
+
+    u32_t rcv_wnd;
+    struct pbuf *refused;
+};
+
+const ip_addr_t ip_addr_any;
+
+static struct tcp_pcb *pcbs[MAX_PCBS];
+static lwip_host_stats_t stats;
+static struct tcp_pcb *input_pcb;   // pcb cujo segmento está sendo processado
+static unsigned fast_ms, slow_ms;
+
+/* ─── CONTAS ───────────────────────────────────────────────────────── */
+static void use(unsigned *now, unsigned *max, int delta) {
+    *now = (unsigned)((int)*now + delta);
+    if (*now > *max)
+        *max = *now;
+}
+
+#define USE(field, delta) use(&stats.now.field, &stats.max.field, (delta))
+
+// Bloco do heap para um pbuf PBUF_RAM com offset de cabeçalhos e len de dados
+static unsigned ram_pbuf(unsigned offset, unsigned len) {
+    unsigned size = LWIP_MEM_ALIGN_SIZE(SIZEOF_STRUCT_PBUF + offset) + LWIP_MEM_ALIGN_SIZE(len);
+    if (size < MEM_MIN_SIZE)
+        size = MEM_MIN_SIZE;
+    return LWIP_MEM_ALIGN_SIZE(size) + SIZEOF_STRUCT_MEM;
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Tempo dentro dos callbacks do servidor; os aninhados (tcp_abort -> tcp_err) contam uma vez
+static int callback_depth;
+static double callback_start;
+
+static void callback_enter(void) {
+    if (callback_depth++ == 0)
+        callback_start = now_ns();
+}
+
+static void callback_leave(void) {
+    if (--callback_depth == 0)
+        stats.callback_ns += now_ns() - callback_start;
+}
+
+// O lwIP usaria o pcb já liberado se o callback que chamou tcp_abort não retornasse ERR_ABRT
+static void callback_check(const struct tcp_pcb *pcb, err_t err) {
+    if (pcb->aborted && err != ERR_ABRT)
+        abort();
+}
+
+/* ─── PBUFS ────────────────────────────────────────────────────────── */
+static struct pbuf *pool_alloc(const char *data, size_t len) {
+    struct pbuf *p = malloc(sizeof(*p) + PBUF_POOL_BUFSIZE);
+    if (!p)
+        abort();
+    memset(p, 0, sizeof(*p));
+    p->payload = p + 1;
+    memcpy(p->payload, data, len);
+    p->len = p->tot_len = (u16_t)len;
+    p->ref = 1;
+    USE(pbuf_pool, 1);
+    return p;
+}
+
+u8_t pbuf_free(struct pbuf *p) {
+    u8_t count = 0;
+    while (p) {
+        struct pbuf *next = p->next;
+        if (--p->ref > 0)
+            break;
+        free(p);
+        USE(pbuf_pool, -1);
+        count++;
+        p = next;
+    }
+    return count;
+}
+
+void pbuf_cat(struct pbuf *head, struct pbuf *tail) {
+    struct pbuf *p;
+    for (p = head; p->next; p = p->next)
+        p->tot_len = (u16_t)(p->tot_len + tail->tot_len);
+    p->tot_len = (u16_t)(p->tot_len + tail->tot_len);
+    p->next = tail;
+}
+
+u8_t pbuf_remove_header(struct pbuf *p, size_t header_size) {
+    if (header_size > p->len)
+        return 1;
+    p->payload = (char *)p->payload + header_size;
+    p->len = (u16_t)(p->len - header_size);
+    p->tot_len = (u16_t)(p->tot_len - header_size);
+    return 0;
+}
+
+u16_t pbuf_clen(const struct pbuf *p) {
+    u16_t n = 0;
+    for (; p; p = p->next)
+        n++;
+    return n;
+}
+
+/* ─── PCBS ─────────────────────────────────────────────────────────── */
+static struct tcp_pcb *pcb_new(void) {
+    for (int i = 0; i < MAX_PCBS; i++) {
+        if (pcbs[i])
+            continue;
+        struct tcp_pcb *pcb = calloc(1, sizeof(*pcb));
+        if (!pcb)
+            abort();
+        pcb->active = true;
+        pcb->snd_buf = TCP_SND_BUF;
+        pcb->rcv_wnd = TCP_WND;
+        pcb->cwnd = INITIAL_CWND;
+        pcb->ssthresh = TCP_SND_BUF;
+        USE(pcb, 1);
+        pcbs[i] = pcb;
+        return pcb;
+    }
+    abort();
+}
+
+static void pcb_free(struct tcp_pcb *pcb) {
+    for (int i = 0; i < MAX_PCBS; i++)
+        if (pcbs[i] == pcb)
+            pcbs[i] = NULL;
+    free(pcb);
+}
+
+// Solta a fila de envio e os dados recusados (tcp_pcb_purge)
+static void pcb_purge(struct tcp_pcb *pcb) {
+    for (size_t i = 0; i < pcb->nseg; i++) {
+        USE(heap, -(int)pcb->segs[i].heap);
+        USE(pbuf_rom, -(int)pcb->segs[i].rom);
+        USE(seg, -1);
+    }
+    pcb->nseg = pcb->nsent = 0;
+    pcb->snd_queuelen = 0;
+    if (pcb->refused)
+        pbuf_free(pcb->refused);
+    pcb->refused = NULL;
+}
+
+// O lwIP libera o pcb: vaga de volta em MEMP_NUM_TCP_PCB
+static void pcb_deactivate(struct tcp_pcb *pcb) {
+    if (!pcb->active)
+        return;
+    pcb_purge(pcb);
+    pcb->active = false;
+    USE(pcb, -1);
+}
+
+// Fechado dos dois lados e tudo confirmado
+static void pcb_maybe_free(struct tcp_pcb *pcb) {
+    if (pcb->active && pcb->closed && pcb->remote_fin && pcb->nseg == 0)
+        pcb_deactivate(pcb);
+}
+
+static void pcb_reset(struct tcp_pcb *pcb) {
+    pcb_deactivate(pcb);
+    pcb->reset = true;
+    pcb->tx_len = pcb->tx_sent = pcb->tx_read = 0;
+    stats.resets++;
+}
+
+/* ─── ENVIO ────────────────────────────────────────────────────────── */
+// tcp_do_output_nagle: um segmento pequeno espera a confirmação do anterior
+static bool nagle_allows(const struct tcp_pcb *pcb) {
+    return pcb->nsent == 0 || pcb->nseg - pcb->nsent > 1 || pcb->segs[pcb->nsent].len >= TCP_MSS ||
+           pcb->snd_buf == 0 || pcb->snd_queuelen >= TCP_SND_QUEUELEN || pcb->nagle_memerr || pcb->closed;
+}
+
+// Envia os segmentos não enviados que cabem na janela de congestionamento
+static void host_output(struct tcp_pcb *pcb) {
+    if (!pcb->active)
+        return;
+    while (pcb->nsent < pcb->nseg) {
+        const seg_t *s = &pcb->segs[pcb->nsent];
+        if (pcb->tx_sent + s->len > pcb->cwnd || !nagle_allows(pcb))
+            break;
+        pcb->tx_sent += s->len;
+        pcb->fin_sent |= s->fin;
+        pcb->nsent++;
+    }
+    if (pcb->nsent == pcb->nseg)
+        pcb->nagle_memerr = false;
+}
+
+// Memória para uma escrita: falha sem mudar nada, como o memerr do tcp_write
+static err_t write_error(struct tcp_pcb *pcb) {
+    pcb->nagle_memerr = true;
+    stats.write_mem++;
+    return ERR_MEM;
+}
+
+/* tcp_pbuf_prealloc: tamanho do pbuf copiado. Com LWIP_NETIF_TX_SINGLE_PBUF
+   é sempre o máximo; senão sobra TCP_OVERSIZE se vier mais coisa. */
+static u16_t prealloc_len(const struct tcp_pcb *pcb, u16_t len, u16_t max_len, u8_t apiflags, bool first_seg) {
+#if LWIP_NETIF_TX_SINGLE_PBUF
+    (void)pcb;
+    (void)len;
+    (void)apiflags;
+    (void)first_seg;
+    return max_len;
+#else
+    if (len < max_len && ((apiflags & TCP_WRITE_FLAG_MORE) || !first_seg || pcb->nseg)) {
+        u16_t alloc = (u16_t)LWIP_MEM_ALIGN_SIZE(len + TCP_OVERSIZE);
+        return alloc < max_len ? alloc : max_len;
+    }
+    return len;
+#endif
+}
+
+err_t tcp_write(struct tcp_pcb *pcb, const void *dataptr, u16_t len, u8_t apiflags) {
+#if LWIP_NETIF_TX_SINGLE_PBUF
+    apiflags |= TCP_WRITE_FLAG_COPY;   // como no lwIP: sempre copia, para sair num pbuf só
+#endif
+    if (!pcb->active || pcb->closed)
+        return ERR_CONN;
+    if (len > pcb->snd_buf || pcb->snd_queuelen >= TCP_SND_QUEUELEN)
+        return write_error(pcb);
+    if (len == 0)
+        return ERR_OK;
+    bool copy = apiflags & TCP_WRITE_FLAG_COPY;
+
+    // Planeja sem mudar nada
+    seg_t *last = pcb->nseg > pcb->nsent ? &pcb->segs[pcb->nseg - 1] : NULL;
+    u16_t pos = 0, queuelen = pcb->snd_queuelen;
+    unsigned heap = 0, rom = 0;
+    seg_t grow = {0};   // o que entra no último segmento não enviado
+    if (last) {
+        // Fase 1: espaço que sobrou no pbuf do último segmento (oversize)
+        u16_t space = (u16_t)(TCP_MSS - last->len);
+        u16_t used = last->room < len ? last->room : len;
+        pos = used;
+        grow.len = used;
+        grow.room = (u16_t)(last->room - used);
+        space = (u16_t)(space - used);
+        // Fase 2: mais um pbuf encadeado no mesmo segmento, até o MSS
+        if (pos < len && space > 0 && last->len > 0) {
+            u16_t seglen = (u16_t)(len - pos) < space ? (u16_t)(len - pos) : space;
+            if (copy) {
+                u16_t alloc = prealloc_len(pcb, seglen, space, apiflags, true);
+                grow.heap = (u16_t)ram_pbuf(PBUF_RAW_HLEN, alloc);
+                grow.room = (u16_t)(alloc - seglen);
+            } else {
+                grow.rom = 1;
+                grow.room = 0;
+            }
+            grow.pbufs = 1;
+            grow.len = (u16_t)(grow.len + seglen);
+            pos = (u16_t)(pos + seglen);
+            queuelen++;
+        }
+        heap += grow.heap;
+        rom += grow.rom;
+    }
+
+    // Fase 3: segmentos novos de até TCP_MSS
+    seg_t add[TCP_SND_QUEUELEN];
+    size_t nadd = 0;
+    while (pos < len) {
+        u16_t seglen = (u16_t)(len - pos) < TCP_MSS ? (u16_t)(len - pos) : TCP_MSS;
+        seg_t s = { .len = seglen };
+        if (copy) {
+            u16_t alloc = prealloc_len(pcb, seglen, TCP_MSS, apiflags, nadd == 0);
+            s.heap = (u16_t)ram_pbuf(PBUF_TRANSPORT_HLEN, alloc);
+            s.room = (u16_t)(alloc - seglen);
+            s.pbufs = 1;
+        } else {
+            // pbuf de cabeçalhos do heap + PBUF_ROM apontando para os dados
+            s.heap = (u16_t)ram_pbuf(PBUF_TRANSPORT_HLEN, 0);
+            s.rom = 1;
+            s.pbufs = 2;
+        }
+        queuelen = (u16_t)(queuelen + s.pbufs);
+        if (queuelen > TCP_SND_QUEUELEN)
+            return write_error(pcb);
+        heap += s.heap;
+        rom += s.rom;
+        add[nadd++] = s;
+        pos = (u16_t)(pos + seglen);
+    }
+    if (stats.now.heap + heap > MEM_SIZE || stats.now.seg + nadd > MEMP_NUM_TCP_SEG ||
+        stats.now.pbuf_rom + rom > MEMP_NUM_PBUF)
+        return write_error(pcb);
+
+    // Aplica
+    if (last) {
+        last->len = (u16_t)(last->len + grow.len);
+        last->room = grow.room;
+        last->heap = (u16_t)(last->heap + grow.heap);
+        last->pbufs = (u8_t)(last->pbufs + grow.pbufs);
+        last->rom = (u8_t)(last->rom + grow.rom);
+    }
+    for (size_t i = 0; i < nadd; i++)
+        pcb->segs[pcb->nseg++] = add[i];
+    memcpy(pcb->tx + pcb->tx_len, dataptr, len);
+    pcb->tx_len += len;
+    pcb->snd_buf = (u16_t)(pcb->snd_buf - len);
+    pcb->snd_queuelen = queuelen;
+    USE(heap, (int)heap);
+    USE(seg, (int)nadd);
+    USE(pbuf_rom, (int)rom);
+    if (pcb->snd_queuelen > stats.max.snd_queuelen)
+        stats.max.snd_queuelen = pcb->snd_queuelen;
+    if (pcb->tx_len > stats.max.snd_bytes)
+        stats.max.snd_bytes = (unsigned)pcb->tx_len;
+    return ERR_OK;
+}
+
+err_t tcp_output(struct tcp_pcb *pcb) {
+    // Chamado de dentro do processamento de um segmento: sai no fim dele
+    if (pcb != input_pcb)
+        host_output(pcb);
+    return ERR_OK;
+}
+
+u16_t tcp_sndbuf(const struct tcp_pcb *pcb) {
+    return pcb->snd_buf;
+}
+
+u16_t tcp_sndqueuelen(const struct tcp_pcb *pcb) {
+    return pcb->snd_queuelen;
+}
+
+/* ─── API RAW ──────────────────────────────────────────────────────── */
+struct tcp_pcb *tcp_new_ip_type(u8_t type) {
+    (void)type;
+    if (stats.now.pcb >= MEMP_NUM_TCP_PCB)
+        return NULL;
+    return pcb_new();
+}
+
+err_t tcp_bind(struct tcp_pcb *pcb, const ip_addr_t *ipaddr, u16_t port) {
+    (void)ipaddr;
+    for (int i = 0; i < MAX_PCBS; i++)
+        if (pcbs[i] && pcbs[i]->listening && pcbs[i]->port == port)
+            return ERR_USE;
+    pcb->port = port;
+    return ERR_OK;
+}
+
+// O pcb de escuta sai de MEMP_NUM_TCP_PCB (vai para MEMP_NUM_TCP_PCB_LISTEN)
+struct tcp_pcb *tcp_listen(struct tcp_pcb *pcb) {
+    pcb_deactivate(pcb);
+    pcb->listening = true;
+    return pcb;
+}
+
+void tcp_arg(struct tcp_pcb *pcb, void *arg) {
+    pcb->callback_arg = arg;
+}
+
+void tcp_accept(struct tcp_pcb *pcb, tcp_accept_fn accept) {
+    pcb->accept = accept;
+}
+
+void tcp_recv(struct tcp_pcb *pcb, tcp_recv_fn recv) {
+    pcb->recv = recv;
+}
+
+void tcp_sent(struct tcp_pcb *pcb, tcp_sent_fn sent) {
+    pcb->sent = sent;
+}
+
+void tcp_poll(struct tcp_pcb *pcb, tcp_poll_fn poll, u8_t interval) {
+    pcb->poll = poll;
+    pcb->pollinterval = interval;
+}
+
+void tcp_err(struct tcp_pcb *pcb, tcp_err_fn err) {
+    pcb->errf = err;
+}
+
+void tcp_recved(struct tcp_pcb *pcb, u16_t len) {
+    pcb->rcv_wnd += len;
+    if (pcb->rcv_wnd > TCP_WND)
+        pcb->rcv_wnd = TCP_WND;
+}
+
+void tcp_abort(struct tcp_pcb *pcb) {
+    if (!pcb->active)
+        return;
+    tcp_err_fn errf = pcb->errf;
+    void *arg = pcb->callback_arg;
+    pcb_reset(pcb);
+    pcb->aborted = true;
+    if (errf) {
+        callback_enter();
+        errf(arg, ERR_ABRT);
+        callback_leave();
+    }
+}
+
+err_t tcp_close(struct tcp_pcb *pcb) {
+    if (pcb->listening) {
+        pcb->listening = false;
+        pcb->accept = NULL;
+        return ERR_OK;
+    }
+    if (!pcb->active || pcb->closed)
+        return ERR_OK;
+    // Recebido e não lido pela aplicação: RST em vez de FIN (tcp_close_shutdown)
+    if (pcb->refused || pcb->rcv_wnd != TCP_WND) {
+        pcb_reset(pcb);
+        return ERR_OK;
+    }
+    // FIN vai no último segmento não enviado ou num segmento só dele
+    if (pcb->nseg > pcb->nsent) {
+        pcb->segs[pcb->nseg - 1].fin = true;
+    } else {
+        unsigned heap = ram_pbuf(PBUF_TRANSPORT_HLEN, 0);
+        if (pcb->snd_queuelen >= TCP_SND_QUEUELEN || stats.now.heap + heap > MEM_SIZE ||
+            stats.now.seg >= MEMP_NUM_TCP_SEG) {
+            stats.close_mem++;
+            return ERR_MEM;
+        }
+        pcb->segs[pcb->nseg++] = (seg_t){ .heap = (u16_t)heap, .pbufs = 1, .fin = true };
+        pcb->snd_queuelen++;
+        USE(heap, (int)heap);
+        USE(seg, 1);
+    }
+    pcb->closed = true;
+    if (pcb != input_pcb)
+        host_output(pcb);
+    pcb_maybe_free(pcb);
+    return ERR_OK;
+}
+
+/* ─── ENTRADA (SEGMENTOS DO CLIENTE) ───────────────────────────────── */
+// Entrega dados (ou o FIN, p == NULL) ao tcp_recv; retorna false se o pcb foi abortado
+static bool deliver(struct tcp_pcb *pcb, struct pbuf *p) {
+    err_t err;
+    struct tcp_pcb *outer = input_pcb;
+    input_pcb = pcb;
+    callback_enter();
+    if (pcb->recv) {
+        err = pcb->recv(pcb->callback_arg, pcb, p, ERR_OK);
+    } else if (p) {   // tcp_recv_null
+        tcp_recved(pcb, p->tot_len);
+        pbuf_free(p);
+        err = ERR_OK;
+    } else {
+        err = tcp_close(pcb);
+    }
+    callback_leave();
+    callback_check(pcb, err);
+    input_pcb = outer;
+    if (err == ERR_ABRT || !pcb->active)
+        return false;
+    if (err != ERR_OK && p) {
+        pcb->refused = p;
+        stats.rx_refused++;
+    }
+    return true;
+}
+
+// tcp_process_refused_data: entrega de novo o que a aplicação recusou
+static void process_refused(struct tcp_pcb *pcb) {
+    if (pcb->active && pcb->refused) {
+        struct pbuf *p = pcb->refused;
+        pcb->refused = NULL;
+        if (!deliver(pcb, p))
+            return;
+        if (pcb->refused)
+            stats.rx_refused--;   // a mesma recusa, não uma nova
+    }
+    if (pcb->active && !pcb->refused && pcb->fin_pending) {
+        pcb->fin_pending = false;
+        if (!pcb->closed && !deliver(pcb, NULL))
+            return;
+        pcb_maybe_free(pcb);
+    }
+    host_output(pcb);
+}
+
+struct tcp_pcb *lwip_host_connect(u16_t port) {
+    struct tcp_pcb *listener = NULL;
+    for (int i = 0; i < MAX_PCBS; i++)
+        if (pcbs[i] && pcbs[i]->listening && pcbs[i]->port == port)
+            listener = pcbs[i];
+    if (!listener || !listener->accept)
+        return NULL;
+    if (stats.now.pcb >= MEMP_NUM_TCP_PCB) {
+        stats.syn_dropped++;
+        return NULL;
+    }
+    struct tcp_pcb *pcb = pcb_new();
+    pcb->port = port;
+    pcb->callback_arg = listener->callback_arg;
+
+    input_pcb = pcb;
+    callback_enter();
+    err_t err = listener->accept(listener->callback_arg, pcb, ERR_OK);
+    callback_leave();
+    callback_check(pcb, err);
+    input_pcb = NULL;
+    if (err != ERR_OK && err != ERR_ABRT)
+        tcp_abort(pcb);
+    host_output(pcb);
+    return pcb;
+}
+
+size_t lwip_host_send(struct tcp_pcb *pcb, const char *data, size_t len) {
+    if (!pcb->active || pcb->remote_fin)
+        return 0;
+    if (pcb->closed) {   // a aplicação fechou a recepção: RST
+        tcp_abort(pcb);
+        return 0;
+    }
+    process_refused(pcb);
+    size_t pos = 0;
+    while (pos < len && pcb->active && !pcb->refused) {
+        size_t n = len - pos;
+        if (n > TCP_MSS)
+            n = TCP_MSS;
+        if (n > pcb->rcv_wnd)
+            n = pcb->rcv_wnd;
+        if (n == 0)
+            break;
+        if (stats.now.pbuf_pool >= PBUF_POOL_SIZE) {
+            stats.rx_dropped++;
+            break;
+        }
+        struct pbuf *p = pool_alloc(data + pos, n);
+        pcb->rcv_wnd -= (u32_t)n;
+        pos += n;
+        if (!deliver(pcb, p))
+            break;
+        host_output(pcb);
+    }
+    return pos;
+}
+
+const char *lwip_host_peek(const struct tcp_pcb *pcb, size_t *len) {
+    *len = pcb->tx_sent - pcb->tx_read;
+    return pcb->tx + pcb->tx_read;
+}
+
+void lwip_host_ack(struct tcp_pcb *pcb) {
+    pcb->tx_read = pcb->tx_sent;
+    if (!pcb->active)
+        return;
+    process_refused(pcb);
+    // Só o que o cliente já leu; o que sair durante os tcp_sent fica para o próximo ACK
+    size_t to_ack = pcb->nsent;
+    while (to_ack && pcb->active) {
+        size_t k = to_ack < 2 ? to_ack : 2;
+        u16_t acked = 0;
+        for (size_t i = 0; i < k; i++) {
+            const seg_t *s = &pcb->segs[i];
+            acked = (u16_t)(acked + s->len);
+            pcb->snd_queuelen = (u16_t)(pcb->snd_queuelen - s->pbufs);
+            USE(heap, -(int)s->heap);
+            USE(pbuf_rom, -(int)s->rom);
+            USE(seg, -1);
+        }
+        memmove(pcb->segs, pcb->segs + k, (pcb->nseg - k) * sizeof(seg_t));
+        pcb->nseg -= k;
+        pcb->nsent -= k;
+        to_ack -= k;
+        memmove(pcb->tx, pcb->tx + acked, pcb->tx_len - acked);
+        pcb->tx_len -= acked;
+        pcb->tx_sent -= acked;
+        pcb->tx_read -= acked;
+        pcb->snd_buf = (u16_t)(pcb->snd_buf + acked);
+
+        // RFC 3465: slow start até ssthresh, depois um MSS por janela
+        if (pcb->cwnd < pcb->ssthresh) {
+            pcb->cwnd += acked < 2 * TCP_MSS ? acked : 2 * TCP_MSS;
+        } else {
+            pcb->bytes_acked += acked;
+            if (pcb->bytes_acked >= pcb->cwnd) {
+                pcb->bytes_acked -= pcb->cwnd;
+                pcb->cwnd += TCP_MSS;
+            }
+        }
+
+        if (acked && pcb->sent) {
+            input_pcb = pcb;
+            callback_enter();
+            err_t err = pcb->sent(pcb->callback_arg, pcb, acked);
+            callback_leave();
+            callback_check(pcb, err);
+            input_pcb = NULL;
+            if (err == ERR_ABRT || !pcb->active)
+                return;
+        }
+        pcb_maybe_free(pcb);
+        host_output(pcb);
+    }
+}
+
+void lwip_host_close(struct tcp_pcb *pcb) {
+    if (!pcb->active || pcb->remote_fin)
+        return;
+    pcb->remote_fin = true;
+    process_refused(pcb);
+    if (!pcb->active)
+        return;
+    if (pcb->refused) {
+        pcb->fin_pending = true;
+        return;
+    }
+    // Depois do tcp_close a aplicação não recebe mais nada
+    if (pcb->closed || deliver(pcb, NULL)) {
+        host_output(pcb);
+        pcb_maybe_free(pcb);
+    }
+}
+
+lwip_host_state_t lwip_host_state(const struct tcp_pcb *pcb) {
+    if (pcb->reset)
+        return LWIP_HOST_RESET;
+    if ((pcb->fin_sent || !pcb->active) && pcb->tx_read == pcb->tx_sent)
+        return LWIP_HOST_EOF;
+    return LWIP_HOST_OPEN;
+}
+
+void lwip_host_release(struct tcp_pcb *pcb) {
+    if (pcb->active && !pcb->closed) {
+        // Cliente foi embora sem fechar: RST
+        tcp_err_fn errf = pcb->errf;
+        void *arg = pcb->callback_arg;
+        pcb_deactivate(pcb);
+        if (errf) {
+            callback_enter();
+            errf(arg, ERR_RST);
+            callback_leave();
+        }
+    }
+    pcb_deactivate(pcb);
+    pcb_free(pcb);
+}
+
+/* ─── TIMERS ───────────────────────────────────────────────────────── */
+// tcp_fasttmr: dados recusados
+static void fast_timer(void) {
+    for (int i = 0; i < MAX_PCBS; i++) {
+        struct tcp_pcb *pcb = pcbs[i];
+        if (pcb && pcb->active && (pcb->refused || pcb->fin_pending)) {
+            process_refused(pcb);
+            host_output(pcb);
+        }
+    }
+}
+
+// tcp_slowtmr: tcp_poll
+static void slow_timer(void) {
+    for (int i = 0; i < MAX_PCBS; i++) {
+        struct tcp_pcb *pcb = pcbs[i];
+        if (!pcb || !pcb->active)
+            continue;
+        if (++pcb->polltmr < pcb->pollinterval)
+            continue;
+        pcb->polltmr = 0;
+        if (!pcb->poll)
+            continue;
+        callback_enter();
+        err_t err = pcb->poll(pcb->callback_arg, pcb);
+        callback_leave();
+        callback_check(pcb, err);
+        if (err == ERR_OK)
+            host_output(pcb);
+    }
+}
+
+void lwip_host_advance(unsigned ms) {
+    fast_ms += ms;
+    slow_ms += ms;
+    while (fast_ms >= 250) {
+        fast_ms -= 250;
+        fast_timer();
+    }
+    while (slow_ms >= 500) {
+        slow_ms -= 500;
+        slow_timer();
+    }
+}
+
+const lwip_host_stats_t *lwip_host_stats(void) {
+    return &stats;
+}
+
+void lwip_host_reset_stats(void) {
+    lwip_host_usage_t now = stats.now;
+    memset(&stats, 0, sizeof(stats));
+    stats.now = now;
+    stats.max = now;
+    stats.max.snd_queuelen = 0;
+    stats.max.snd_bytes = 0;
+}
@@ -0,0 +1,97 @@
+/*
+ * lwIP de mentira para rodar o servidor HTTP no PC (teste de carga).
+ *
+ * Implementa a parte da API raw de TCP que http_server.c e http_events.c
+ * usam (lwip/tcp.h deste diretório), com os limites do lwipopts.h do
+ * projeto: pcbs (MEMP_NUM_TCP_PCB), segmentos (MEMP_NUM_TCP_SEG), pbufs
+ * recebidos (PBUF_POOL_SIZE), heap (MEM_SIZE), fila e buffer de envio por
+ * pcb (TCP_SND_QUEUELEN, TCP_SND_BUF) e janela de recepção (TCP_WND). Cada
+ * limite falha como no lwIP: tcp_write e tcp_close com ERR_MEM, pacote
+ * descartado sem pbuf livre, SYN descartado sem pcb livre, dados recusados
+ * (recv com ERR_MEM) entregues de novo depois.
+ *
+ * O tcp_write segue o do lwIP 2.1: com LWIP_NETIF_TX_SINGLE_PBUF tudo é
+ * copiado num pbuf do tamanho do MSS tirado do heap, e as escritas seguintes
+ * enchem o espaço que sobrou (oversize) enquanto o segmento não sai. O
+ * envio segue o algoritmo de Nagle e a janela de congestionamento (slow
+ * start). Um pbuf do heap custa o cabeçalho do mem, o struct pbuf e os
+ * cabeçalhos Ethernet/IP/TCP, como num ARM de 32 bits.
+ *
+ * Não há rede: o "cliente" é quem chama as funções abaixo, e cada chamada
+ * é um segmento que chega ao pcb. Fora do modelo: perdas e retransmissões
+ * (um pacote descartado é só reenviado pelo cliente), a janela anunciada
+ * pelo cliente (sempre grande), fragmentação do heap, TIME_WAIT (o pcb é
+ * liberado quando tudo foi confirmado) e o resto da pilha (ARP, DHCP, DNS),
+ * que também usa o heap e os pools.
+ */
+#ifndef LWIP_HOST_H
+#define LWIP_HOST_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "lwip/tcp.h"
+
+// Uso dos pools e do heap
+typedef struct {
+    unsigned pcb;            // MEMP_NUM_TCP_PCB (sem o de escuta)
+    unsigned seg;            // MEMP_NUM_TCP_SEG
+    unsigned pbuf_pool;      // PBUF_POOL_SIZE (recebidos)
+    unsigned pbuf_rom;       // MEMP_NUM_PBUF (envio sem cópia)
+    unsigned heap;           // MEM_SIZE, em bytes
+    unsigned snd_queuelen;   // TCP_SND_QUEUELEN, maior fila de um pcb (só em max)
+    unsigned snd_bytes;      // TCP_SND_BUF, maior ocupação de um pcb (só em max)
+} lwip_host_usage_t;
+
+typedef struct {
+    lwip_host_usage_t now;
+    lwip_host_usage_t max;       // picos desde lwip_host_reset_stats
+    unsigned write_mem;          // tcp_write com ERR_MEM
+    unsigned close_mem;          // tcp_close com ERR_MEM
+    unsigned rx_dropped;         // pacotes descartados: PBUF_POOL vazio
+    unsigned rx_refused;         // recv retornou ERR_MEM (entregue de novo depois)
+    unsigned syn_dropped;        // conexões descartadas: sem pcb livre
+    unsigned resets;             // conexões terminadas com RST (abort ou close com dados não lidos)
+    double callback_ns;          // tempo dentro dos callbacks do servidor
+} lwip_host_stats_t;
+
+typedef enum {
+    LWIP_HOST_OPEN,      // conexão aberta (ou fechando, com dados ainda por ler)
+    LWIP_HOST_EOF,       // o servidor fechou e tudo foi lido
+    LWIP_HOST_RESET      // RST: o que não foi lido se perdeu
+} lwip_host_state_t;
+
+/* Conexão de um cliente na porta (SYN + handshake + accept). NULL se não
+   havia pcb livre (SYN descartado). Um pcb retornado fica válido até
+   lwip_host_release, mesmo depois de o servidor fechar. */
+struct tcp_pcb *lwip_host_connect(u16_t port);
+
+/* Cliente envia len bytes, em segmentos de até TCP_MSS. Retorna quantos o
+   servidor recebeu: para na janela fechada, sem pbuf livre no PBUF_POOL ou
+   com dados recusados ainda pendentes (o resto é reenviado depois). */
+size_t lwip_host_send(struct tcp_pcb *pcb, const char *data, size_t len);
+
+// Dados já enviados pelo servidor e ainda não lidos
+const char *lwip_host_peek(const struct tcp_pcb *pcb, size_t *len);
+
+/* Cliente leu o que lwip_host_peek mostrou e confirma (um ACK a cada dois
+   segmentos): o servidor recebe os tcp_sent e pode enviar mais. */
+void lwip_host_ack(struct tcp_pcb *pcb);
+
+// Cliente fecha a conexão (FIN); continua lendo até LWIP_HOST_EOF
+void lwip_host_close(struct tcp_pcb *pcb);
+
+lwip_host_state_t lwip_host_state(const struct tcp_pcb *pcb);
+
+/* Cliente esquece a conexão. Se o servidor ainda não tinha fechado, é um
+   RST (tcp_err com ERR_RST). */
+void lwip_host_release(struct tcp_pcb *pcb);
+
+// Passa o tempo: timers do TCP (250 ms e 500 ms: tcp_poll, dados recusados)
+void lwip_host_advance(unsigned ms);
+
+const lwip_host_stats_t *lwip_host_stats(void);
+// Zera os contadores; os picos voltam ao uso atual
+void lwip_host_reset_stats(void);
+
+#endif
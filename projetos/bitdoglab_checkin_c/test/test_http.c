@@ -0,0 +1,434 @@
+/*
+ * Testes no PC da parte HTTP do checkin que não depende do lwIP:
+ * estado e ações (occupancy.c), página em segmentos com cache/ETag
+ * (http_page.c), tabela de rotas (http_router.c), API JSON (http_api.c, com
+ * as requisições lidas pelo http_parser.c) e arquivos estáticos
+ * (http_assets.c, conferidos contra web/).
+ *
+ * Compilar e rodar (a partir de projetos/bitdoglab_checkin_c):
+ *   gcc -std=c11 -O2 -Wall -I. test/test_http.c occupancy.c http_page.c http_api.c http_assets.c http_parser.c http_router.c http_writer.c -o test_http && ./test_http
+ */
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "occupancy.h"
+#include "http_page.h"
+#include "http_api.h"
+#include "http_assets.h"
+#include "http_router.h"
+
+static http_page_cache_t cache;
+
+// Junta os segmentos numa string, como o cliente recebe
+static size_t join(const http_segment_t *seg, size_t n, char *out, size_t out_len) {
+    size_t k = 0;
+    for (size_t i = 0; i < n; i++) {
+        assert(k + seg[i].len < out_len);
+        memcpy(out + k, seg[i].data, seg[i].len);
+        k += seg[i].len;
+    }
+    out[k] = '\0';
+    return k;
+}
+
+static const http_segment_t *get_page(size_t *n) {
+    return http_page_get(&cache, n, occupancy_version, occupancy, NUM_FLOORS, selected_floor);
+}
+
+static void test_occupancy_version(void) {
+    occupancy_init(100);
+    uint32_t v = occupancy_version;
+
+    assert(occupancy_apply("1", "add", ""));
+    assert(occupancy[1] == 1 && selected_floor == 1 && occupancy_version == v + 1);
+    assert(occupancy_apply("1", "set", "50"));
+    assert(occupancy[1] == 50);
+    v = occupancy_version;
+
+    // sem mudança de estado a versão fica: add no máximo, remove em zero, mesmo andar
+    assert(occupancy_apply("1", "add", ""));
+    assert(occupancy_apply("2", "remove", "") && occupancy_version == v + 1);
+    v = occupancy_version;
+    assert(occupancy_apply("2", "remove", "") && occupancy_version == v);
+    assert(!occupancy_select(2) && occupancy_version == v);
+
+    // inválidos não mexem em nada
+    assert(!occupancy_apply("7", "add", "") && !occupancy_select(-1) && !occupancy_select(NUM_FLOORS));
+    assert(!occupancy_apply("2", "jump", "") && occupancy_version == v);
+
+    // ação inválida não muda nem o andar selecionado
+    assert(!occupancy_apply("3", "jump", "") && selected_floor == 2 && occupancy_version == v);
+
+    assert(occupancy_apply("", "clear_all", ""));
+    assert(occupancy[1] == 0 && occupancy_version == v + 1);
+}
+
+static void test_occupancy_batch(void) {
+    occupancy_init(10);
+    occupancy_select(3);
+    uint32_t v = occupancy_version;
+
+    // em ordem, uma versão só, sem mudar o andar selecionado
+    const occupancy_change_t batch[] = {
+        { 0, false, 3 }, { 2, true, 7 }, { 0, false, -1 }, { 2, false, 60 }, { 4, false, -5 },
+    };
+    assert(occupancy_batch(batch, 5));
+    assert(occupancy[0] == 2 && occupancy[2] == MAX_OCCUPANCY && occupancy[4] == 0);
+    assert(occupancy_version == v + 1 && selected_floor == 3);
+
+    // delta como add/remove repetidos: acima do máximo (por set) não sobe, não desce de 0
+    const occupancy_change_t over[] = { { 1, true, 70 }, { 1, false, 5 }, { 0, false, -9 } };
+    assert(occupancy_batch(over, 3) && occupancy[1] == 70 && occupancy[0] == 0);
+
+    // tudo ou nada
+    v = occupancy_version;
+    const occupancy_change_t bad[] = { { 0, false, 4 }, { NUM_FLOORS, false, 1 } };
+    assert(!occupancy_batch(bad, 2) && occupancy[0] == 0 && occupancy_version == v);
+    const occupancy_change_t negative[] = { { 0, false, 4 }, { 1, true, -1 } };
+    assert(!occupancy_batch(negative, 2) && occupancy[0] == 0 && occupancy_version == v);
+
+    // nada muda: a versão fica
+    const occupancy_change_t same[] = { { 1, true, 70 }, { 0, false, -1 } };
+    assert(occupancy_batch(same, 2) && occupancy_version == v);
+}
+
+static void test_occupancy_actions(void) {
+    // cada token cai na sua vaga do hash (uma ação nova com vaga repetida falha aqui)
+    assert(occupancy_action("add") == OCCUPANCY_ADD);
+    assert(occupancy_action("remove") == OCCUPANCY_REMOVE);
+    assert(occupancy_action("clear") == OCCUPANCY_CLEAR);
+    assert(occupancy_action("set") == OCCUPANCY_SET);
+    assert(occupancy_action("clear_all") == OCCUPANCY_CLEAR_ALL);
+
+    const char *invalid[] = { "", "ad", "adds", "sat", "Set", "clear_al", "clear_alll", "clear_all_floors", "remova" };
+    for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++)
+        assert(occupancy_action(invalid[i]) == OCCUPANCY_INVALID);
+
+    occupancy_init(1);
+    assert(occupancy_do(OCCUPANCY_SET, 4, 9) && occupancy[4] == 9 && selected_floor == 4);
+    assert(!occupancy_do(OCCUPANCY_INVALID, 4, 0) && !occupancy_do(OCCUPANCY_ADD, NUM_FLOORS, 0));
+    assert(occupancy_do(OCCUPANCY_CLEAR_ALL, -1, 0) && occupancy[4] == 0 && selected_floor == 4);
+}
+
+static void handler_a(const http_request_t *req, int id, void *conn, http_response_t *res) {
+    (void)req;
+    (void)conn;
+    res->count = 100 + (size_t)(id + 1);
+}
+
+static void handler_b(const http_request_t *req, int id, void *conn, http_response_t *res) {
+    (void)req;
+    (void)conn;
+    res->count = 200 + (size_t)(id + 1);
+}
+
+static void handler_other(const http_request_t *req, int id, void *conn, http_response_t *res) {
+    (void)req;
+    (void)id;
+    (void)conn;
+    res->count = 405;
+}
+
+static void test_router(void) {
+    static const http_route_t routes[] = {
+        { "/",           { [HTTP_METHOD_OTHER] = handler_other, [HTTP_METHOD_GET] = handler_a } },
+        { "/a",          { [HTTP_METHOD_OTHER] = handler_other, [HTTP_METHOD_GET] = handler_a, [HTTP_METHOD_POST] = handler_b } },
+        { "/a/#",        { [HTTP_METHOD_OTHER] = handler_other, [HTTP_METHOD_POST] = handler_b } },
+        { "/api/stats",  { [HTTP_METHOD_OTHER] = handler_other, [HTTP_METHOD_GET] = handler_b } },
+        { "/api/config", { [HTTP_METHOD_OTHER] = handler_other, [HTTP_METHOD_GET] = handler_b } },
+    };
+    static const http_route_t fallback = { NULL, { handler_other, handler_other, handler_other } };
+    http_router_t router;
+    int id;
+
+    assert(http_router_init(&router, routes, sizeof(routes) / sizeof(routes[0]), &fallback));
+    assert(http_router_find(&router, "/", &id) == &routes[0] && id == -1);
+    assert(http_router_find(&router, "/a", &id) == &routes[1] && id == -1);
+    assert(http_router_find(&router, "/a/0", &id) == &routes[2] && id == 0);
+    assert(http_router_find(&router, "/a/1234", &id) == &routes[2] && id == 1234);
+    assert(http_router_find(&router, "/api/config", &id) == &routes[4]);
+    // '#' só casa com o último segmento, de dígitos (e curto o bastante para um int)
+    assert(!http_router_find(&router, "/a/12345", &id));
+    assert(!http_router_find(&router, "/a/1x", &id) && !http_router_find(&router, "/a/", &id));
+    assert(!http_router_find(&router, "/a/#", &id) && !http_router_find(&router, "/a/3/b", &id));
+    assert(!http_router_find(&router, "/ab", &id) && !http_router_find(&router, "/api/stat", &id));
+
+    // handler pelo método; sem handler próprio, o de HTTP_METHOD_OTHER
+    http_request_t req = { .method = HTTP_METHOD_POST, .path = "/a/7" };
+    http_response_t res;
+    http_router_dispatch(&router, &req, NULL, &res);
+    assert(res.count == 208);
+    req.method = HTTP_METHOD_GET;
+    http_router_dispatch(&router, &req, NULL, &res);
+    assert(res.count == 405);
+    strcpy(req.path, "/nada");
+    http_router_dispatch(&router, &req, NULL, &res);
+    assert(res.count == 405);
+
+    // caminho repetido ou rotas demais para o índice
+    static const http_route_t twice[] = { { "/x", { handler_other } }, { "/x", { handler_other } } };
+    assert(!http_router_init(&router, twice, 2, &fallback));
+    static http_route_t many[HTTP_ROUTER_SLOTS / 2 + 1];
+    assert(!http_router_init(&router, many, sizeof(many) / sizeof(many[0]), &fallback));
+}
+
+static void test_page_cache(void) {
+    static char text[4096];
+    size_t n;
+
+    occupancy_init(0x1234abcd);
+    http_page_cache_init(&cache);
+    occupancy_apply("3", "set", "42");
+
+    const http_segment_t *seg = get_page(&n);
+    assert(n == HTTP_PAGE_SEGMENTS && cache.renders == 1);
+    join(seg, n, text, sizeof text);
+    assert(strncmp(text, "HTTP/1.1 200 OK\r\n", 17) == 0);
+    assert(strstr(text, "ETag: \"1234abce\"\r\nContent-Length: "));
+    // Content-Length confere com o corpo (conexões persistentes dependem dele)
+    const char *body = strstr(text, "\r\n\r\n") + 4;
+    assert(strncmp(body, "<!DOCTYPE html>", 15) == 0);
+    assert((size_t)atoi(strstr(text, "Content-Length: ") + 16) == strlen(body));
+    assert(strstr(text, "<option value=\"3\" selected>Andar 3</option>"));
+    assert(strstr(text, "<tr><td>Andar 3</td><td>42 pessoas</td></tr>"));
+    assert(strstr(text, "</table></body></html>") == text + strlen(text) - 22);
+
+    // só o texto gerado pede TCP_WRITE_FLAG_COPY
+    for (size_t i = 0; i < n; i++)
+        assert(seg[i].copy == (i % 2 == 1));
+
+    // mesma versão: nada é gerado de novo
+    get_page(&n);
+    get_page(&n);
+    assert(cache.renders == 1);
+
+    assert(http_page_etag_matches(&cache, " \"1234abce\"", 11));
+    assert(http_page_etag_matches(&cache, " W/\"1234abce\"", 13));
+    assert(http_page_etag_matches(&cache, " \"00000000\", \"1234abce\"", 23));
+    assert(!http_page_etag_matches(&cache, " \"1234abcd\"", 11));
+    assert(!http_page_etag_matches(&cache, " \"1234abce", 10));
+
+    http_segment_t nm[HTTP_PAGE_NOT_MODIFIED_SEGMENTS];
+    n = http_page_not_modified(&cache, nm);
+    join(nm, n, text, sizeof text);
+    assert(strcmp(text, "HTTP/1.1 304 Not Modified\r\nCache-Control: no-cache\r\n"
+                        "ETag: \"1234abce\"\r\n\r\n") == 0);
+
+    // mudou o estado: página nova e a ETag antiga deixa de valer
+    occupancy_apply("3", "add", "");
+    seg = get_page(&n);
+    assert(cache.renders == 2);
+    join(seg, n, text, sizeof text);
+    assert(strstr(text, "<td>43 pessoas</td>"));
+    assert(!http_page_etag_matches(&cache, "\"1234abce\"", 10));
+    assert(http_page_etag_matches(&cache, "\"1234abcf\"", 10));
+}
+
+static void test_page_overflow(void) {
+    char small[64];
+    http_segment_t seg[HTTP_PAGE_SEGMENTS];
+    assert(http_page_render(seg, small, sizeof small, 0, occupancy, NUM_FLOORS, 0) == 0);
+}
+
+// Chama a API pela tabela de rotas e devolve a resposta inteira em text; retorna o início do corpo
+static const char *api(const char *method, const char *path, const char *body, char *text, size_t text_len) {
+    static const http_route_t routes[] = { HTTP_API_ROUTES };
+    static const http_route_t fallback = {
+        NULL, { http_api_not_found, http_api_not_found, http_api_not_found }
+    };
+    static http_router_t router;
+    if (!router.routes)
+        assert(http_router_init(&router, routes, sizeof(routes) / sizeof(routes[0]), &fallback));
+
+    char request[256];
+    http_parser_t parser;
+    snprintf(request, sizeof request, "%s %s HTTP/1.1\r\nContent-Length: %zu\r\n\r\n%s",
+             method, path, body ? strlen(body) : 0, body ? body : "");
+    http_parser_init(&parser);
+    http_parser_feed(&parser, request, strlen(request));
+    assert(http_parser_status(&parser) == HTTP_PARSE_DONE);
+
+    http_response_t res;
+    assert(http_api_match(parser.req.path));
+    http_router_dispatch(&router, &parser.req, NULL, &res);
+    assert(res.count == HTTP_API_SEGMENTS);
+    assert(!res.seg[0].copy && res.seg[2].copy);
+    join(res.seg, res.count, text, text_len);
+    const char *json = strstr(text, "\r\n\r\n") + 4;
+    // Content-Length confere com o corpo
+    const char *cl = strstr(text, "Content-Length: ");
+    assert(cl && (size_t)atoi(cl + 16) == strlen(json));
+    return json;
+}
+
+static void test_api(void) {
+    char text[512];
+    const char *json;
+
+    occupancy_init(7);
+    assert(http_api_match("/api/floors") && http_api_match("/api/floors/2") && http_api_match("/api/floors?x=1"));
+    assert(!http_api_match("/") && !http_api_match("/api/floorsx") && !http_api_match("/?floor=1"));
+
+    json = api("GET", "/api/floors", NULL, text, sizeof text);
+    assert(strncmp(text, "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n", 48) == 0);
+    assert(strcmp(json, "{\"version\":7,\"selected\":0,\"max\":50,\"floors\":[0,0,0,0,0]}") == 0);
+
+    json = api("POST", "/api/floors/2", "action=add", text, sizeof text);
+    assert(strcmp(json, "{\"floor\":2,\"count\":1}") == 0 && occupancy[2] == 1);
+    json = api("POST", "/api/floors/2", "action=set&value=17\r\n", text, sizeof text);
+    assert(strcmp(json, "{\"floor\":2,\"count\":17}") == 0);
+    json = api("POST", "/api/floors/2", "value=3&action=remove", text, sizeof text);
+    assert(strcmp(json, "{\"floor\":2,\"count\":16}") == 0);
+    json = api("POST", "/api/floors/%32", "action=%73et&value=1%36", text, sizeof text);
+    assert(strcmp(json, "{\"floor\":2,\"count\":16}") == 0);
+    json = api("GET", "/api/floors/2", NULL, text, sizeof text);
+    assert(strcmp(json, "{\"floor\":2,\"count\":16}") == 0);
+    json = api("GET", "/api/floors", NULL, text, sizeof text);
+    assert(strstr(json, "\"selected\":2,\"max\":50,\"floors\":[0,0,16,0,0]}"));
+
+    uint32_t v = occupancy_version;
+    api("POST", "/api/floors/2", "action=set&value=x", text, sizeof text);
+    assert(strncmp(text, "HTTP/1.1 400", 12) == 0);
+    api("POST", "/api/floors/2", "action=jump", text, sizeof text);
+    assert(strncmp(text, "HTTP/1.1 400", 12) == 0);
+    api("POST", "/api/floors/2", NULL, text, sizeof text);
+    assert(strncmp(text, "HTTP/1.1 400", 12) == 0);
+    api("POST", "/api/floors/2", "action=clear_all", text, sizeof text);
+    assert(strncmp(text, "HTTP/1.1 400", 12) == 0);
+    api("POST", "/api/floors", "action=add", text, sizeof text);
+    assert(strncmp(text, "HTTP/1.1 400", 12) == 0);
+    api("GET", "/api/floors/5", NULL, text, sizeof text);
+    assert(strncmp(text, "HTTP/1.1 404", 12) == 0);
+    api("GET", "/api/floors/1x", NULL, text, sizeof text);
+    assert(strncmp(text, "HTTP/1.1 404", 12) == 0);
+    json = api("DELETE", "/api/floors/1", NULL, text, sizeof text);
+    assert(strncmp(text, "HTTP/1.1 405", 12) == 0 && strcmp(json, "{\"error\":\"method\"}") == 0);
+    assert(occupancy_version == v && occupancy[2] == 16);
+
+    json = api("POST", "/api/floors", "action=clear_all", text, sizeof text);
+    assert(strstr(json, "\"floors\":[0,0,0,0,0]}"));
+
+    // lote: uma versão a mais, estado completo na resposta
+    v = occupancy_version;
+    json = api("POST", "/api/floors/batch", "d0=3&d2=12&d0=-1&s4=9&d3=-2", text, sizeof text);
+    assert(strncmp(text, "HTTP/1.1 200", 12) == 0 && occupancy_version == v + 1);
+    assert(strstr(json, "\"floors\":[2,0,12,0,9]}"));
+    v = occupancy_version;
+    const char *bad[] = {
+        "", "d0=1&x=2", "d5=1", "d=1", "dx=1", "s0=-1", "d0=+1", "d0=1&s1=", "d0=--1", "d0=1234567890",
+    };
+    for (size_t i = 0; i < sizeof(bad) / sizeof(bad[0]); i++) {
+        json = api("POST", "/api/floors/batch", bad[i], text, sizeof text);
+        assert(strncmp(text, "HTTP/1.1 400", 12) == 0);
+    }
+    assert(occupancy_version == v && occupancy[0] == 2);
+    // HTTP_API_BATCH_MAX mudanças do maior tamanho passam; uma a mais é o 400 do lote, não o 413 do parser
+    char batch[128] = "d2=-10";
+    for (int i = 1; i < HTTP_API_BATCH_MAX; i++)
+        strcat(batch, "&d2=-10");
+    json = api("POST", "/api/floors/batch", batch, text, sizeof text);
+    assert(strncmp(text, "HTTP/1.1 200", 12) == 0);
+    assert(strstr(json, "\"floors\":[2,0,0,0,9]}"));
+    v = occupancy_version;
+    strcat(batch, "&d0=-10");
+    json = api("POST", "/api/floors/batch", batch, text, sizeof text);
+    assert(strncmp(text, "HTTP/1.1 400", 12) == 0 && strcmp(json, "{\"error\":\"batch\"}") == 0);
+    assert(occupancy_version == v);
+    json = api("GET", "/api/floors/batch", NULL, text, sizeof text);
+    assert(strncmp(text, "HTTP/1.1 405", 12) == 0 && strstr(text, "\r\nAllow: POST\r\n"));
+    assert(strcmp(json, "{\"error\":\"method\"}") == 0);
+    api("DELETE", "/api/floors/1", NULL, text, sizeof text);
+    assert(strstr(text, "\r\nAllow: GET, POST\r\n"));
+}
+
+// GET de um arquivo estático; retorna o início do corpo em text (cabeçalho + corpo)
+static const char *get_asset(const char *path, const char *headers, char *text, size_t text_len, size_t *body_len) {
+    char request[256];
+    http_parser_t parser;
+    snprintf(request, sizeof request, "GET %s HTTP/1.1\r\n%s\r\n", path, headers);
+    http_parser_init(&parser);
+    http_parser_feed(&parser, request, strlen(request));
+    assert(http_parser_status(&parser) == HTTP_PARSE_DONE);
+
+    http_response_t res;
+    res.seg = res.local;
+    http_assets_get(&parser.req, -1, NULL, &res);
+    for (size_t i = 0; i < res.count; i++)
+        assert(!res.seg[i].copy);   // tudo da flash
+    size_t len = join(res.seg, res.count, text, text_len);
+    const char *body = strstr(text, "\r\n\r\n") + 4;
+    *body_len = len - (size_t)(body - text);
+    return body;
+}
+
+// O corpo original de cada arquivo é o de web/: generated/web_assets.h não ficou para trás
+static void test_assets_current(void) {
+    static const char *files[][2] = {
+        { "/", "web/index.html" }, { "/app.css", "web/app.css" }, { "/app.js", "web/app.js" },
+    };
+    static char text[8192], data[8192];
+    for (size_t i = 0; i < sizeof(files) / sizeof(files[0]); i++) {
+        FILE *f = fopen(files[i][1], "rb");
+        assert(f);
+        size_t n = fread(data, 1, sizeof data, f);
+        fclose(f);
+        size_t body_len;
+        const char *body = get_asset(files[i][0], "", text, sizeof text, &body_len);
+        if (body_len != n || memcmp(body, data, n) != 0) {
+            printf("%s mudou: rode tools/gen_assets.c (comando no topo do arquivo)\n", files[i][1]);
+            assert(0);
+        }
+    }
+}
+
+static void test_assets(void) {
+    static char text[8192];
+    size_t len;
+    const char *body;
+
+    // gzip: cabeçalho e corpo da flash, Content-Length do corpo comprimido
+    body = get_asset("/app.js", "Accept-Encoding: gzip, deflate, br\r\n", text, sizeof text, &len);
+    assert(strncmp(text, "HTTP/1.1 200 OK\r\nContent-Type: text/javascript", 46) == 0);
+    assert(strstr(text, "\r\nContent-Encoding: gzip\r\n") && strstr(text, "\r\nVary: Accept-Encoding\r\n"));
+    assert((size_t)atoi(strstr(text, "Content-Length: ") + 16) == len);
+    assert(len > 10 && (unsigned char)body[0] == 0x1f && (unsigned char)body[1] == 0x8b);
+    char etag_gzip[16];
+    memcpy(etag_gzip, strstr(text, "ETag: ") + 6, 10);
+    etag_gzip[10] = '\0';
+
+    // sem gzip (ou com q=0): original, outra ETag
+    size_t gzip_len = len;
+    body = get_asset("/app.js", "Accept-Encoding: gzip;q=0\r\n", text, sizeof text, &len);
+    assert(!strstr(text, "Content-Encoding") && len > 2 * gzip_len && strncmp(body, "// ", 3) == 0);
+    assert(!strstr(text, etag_gzip));
+
+    // revalidação: 304 só com a ETag da variante pedida
+    char headers[128];
+    snprintf(headers, sizeof headers, "Accept-Encoding: gzip\r\nIf-None-Match: W/%s\r\n", etag_gzip);
+    get_asset("/app.js", headers, text, sizeof text, &len);
+    assert(strncmp(text, "HTTP/1.1 304 Not Modified\r\n", 27) == 0 && len == 0 && strstr(text, etag_gzip));
+    snprintf(headers, sizeof headers, "If-None-Match: %s\r\n", etag_gzip);
+    get_asset("/app.js", headers, text, sizeof text, &len);
+    assert(strncmp(text, "HTTP/1.1 200 OK\r\n", 17) == 0);
+
+    get_asset("/", "Accept-Encoding: gzip\r\n", text, sizeof text, &len);
+    assert(strstr(text, "Content-Type: text/html; charset=utf-8\r\n") && strstr(text, "Content-Encoding: gzip"));
+    assert(http_asset_find("/app.css") && !http_asset_find("/app.css?x=1") && !http_asset_find("/nada"));
+    get_asset("/nada", "", text, sizeof text, &len);
+    assert(strncmp(text, "HTTP/1.1 404", 12) == 0);
+}
+
+int main(void) {
+    test_occupancy_version();
+    test_occupancy_actions();
+    test_occupancy_batch();
+    test_router();
+    test_page_cache();
+    test_page_overflow();
+    test_api();
+    test_assets_current();
+    test_assets();
+    printf("test_http OK\n");
+    return 0;
+}
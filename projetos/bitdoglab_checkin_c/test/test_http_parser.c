@@ -0,0 +1,324 @@
+/*
+ * Testes no PC do leitor de requisições (http_parser.c): casos conhecidos e
+ * fuzzing. O fuzzing corta requisições válidas, mutadas e aleatórias em
+ * pedaços de tamanhos aleatórios (como pbufs) e confere que o resultado é
+ * sempre o mesmo da leitura de uma vez só, sem sair dos buffers fixos.
+ *
+ * Compilar e rodar (a partir de projetos/bitdoglab_checkin_c), de preferência
+ * com os sanitizers:
+ *   gcc -std=c11 -O1 -g -Wall -fsanitize=address,undefined -I. test/test_http_parser.c http_parser.c -o test_http_parser
+ *   ./test_http_parser [iterações] [semente]
+ */
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "http_parser.h"
+
+// Lê text inteiro de uma vez; retorna os bytes usados
+static size_t parse(http_parser_t *p, const char *text, size_t len) {
+    http_parser_init(p);
+    return http_parser_feed(p, text, len);
+}
+
+static http_parse_status_t parse_str(http_parser_t *p, const char *text) {
+    parse(p, text, strlen(text));
+    return http_parser_status(p);
+}
+
+static void test_request_line(void) {
+    http_parser_t p;
+    const char *get = "GET /?floor=2&action=add HTTP/1.1\r\nHost: pico\r\n\r\n";
+    assert(parse(&p, get, strlen(get)) == strlen(get));
+    assert(http_parser_status(&p) == HTTP_PARSE_DONE);
+    assert(p.req.method == HTTP_METHOD_GET && strcmp(p.req.path, "/") == 0);
+    assert(p.req.param_count == 2 && !p.req.close);
+    assert(strcmp(http_param(&p.req, "floor"), "2") == 0);
+    assert(strcmp(http_param(&p.req, "action"), "add") == 0);
+    assert(http_param(&p.req, "value") == NULL);
+    // chave exata: "floor" não casa com "xfloor" nem com "floorx"
+    assert(parse_str(&p, "GET /?xfloor=1&floorx=2 HTTP/1.1\r\n\r\n") == HTTP_PARSE_DONE);
+    assert(http_param(&p.req, "floor") == NULL);
+
+    assert(parse_str(&p, "DELETE /api/floors/1 HTTP/1.1\r\n\r\n") == HTTP_PARSE_DONE);
+    assert(p.req.method == HTTP_METHOD_OTHER && strcmp(p.req.path, "/api/floors/1") == 0);
+
+    // parâmetro sem valor, pares vazios, '=' dentro do valor
+    assert(parse_str(&p, "GET /?debug&&a=b=c& HTTP/1.1\r\n\r\n") == HTTP_PARSE_DONE);
+    assert(p.req.param_count == 2);
+    assert(strcmp(http_param(&p.req, "debug"), "") == 0 && strcmp(http_param(&p.req, "a"), "b=c") == 0);
+
+    // linhas em branco antes da requisição e só '\n' no fim das linhas
+    assert(parse_str(&p, "\r\nGET /x HTTP/1.1\nHost: a\n\n") == HTTP_PARSE_DONE);
+    assert(strcmp(p.req.path, "/x") == 0);
+
+    assert(parse_str(&p, "GET / HTTP/2.0\r\n\r\n") == HTTP_PARSE_BAD_REQUEST);
+    assert(parse_str(&p, "get / HTTP/1.1\r\n\r\n") == HTTP_PARSE_BAD_REQUEST);
+    assert(parse_str(&p, "GET  / HTTP/1.1\r\n\r\n") == HTTP_PARSE_BAD_REQUEST);
+    assert(parse_str(&p, "GET /\r\n\r\n") == HTTP_PARSE_BAD_REQUEST);
+    assert(parse_str(&p, "GET / HTTP/1.1\r\n") == HTTP_PARSE_INCOMPLETE);
+}
+
+static void test_percent(void) {
+    http_parser_t p;
+    assert(parse_str(&p, "GET /api/%66loors%2F2?a=x%2By+z&%61ction=set%26 HTTP/1.1\r\n\r\n") == HTTP_PARSE_DONE);
+    assert(strcmp(p.req.path, "/api/floors/2") == 0);
+    assert(strcmp(http_param(&p.req, "a"), "x+y z") == 0);
+    assert(strcmp(http_param(&p.req, "action"), "set&") == 0);
+    // '+' só vira espaço na query, não no caminho
+    assert(parse_str(&p, "GET /a+b HTTP/1.1\r\n\r\n") == HTTP_PARSE_DONE && strcmp(p.req.path, "/a+b") == 0);
+
+    assert(parse_str(&p, "GET /%zz HTTP/1.1\r\n\r\n") == HTTP_PARSE_BAD_REQUEST);
+    assert(parse_str(&p, "GET /%00 HTTP/1.1\r\n\r\n") == HTTP_PARSE_BAD_REQUEST);
+    assert(parse_str(&p, "GET /%4 HTTP/1.1\r\n\r\n") == HTTP_PARSE_BAD_REQUEST);
+    assert(parse_str(&p, "GET /?a=%4 HTTP/1.1\r\n\r\n") == HTTP_PARSE_BAD_REQUEST);
+    assert(parse_str(&p, "GET /?a=%4&b=1 HTTP/1.1\r\n\r\n") == HTTP_PARSE_BAD_REQUEST);
+}
+
+static void test_headers(void) {
+    http_parser_t p;
+    assert(parse_str(&p, "GET / HTTP/1.1\r\nif-none-match:  W/\"1234abcd\"\r\nCONNECTION: Close\r\n\r\n") == HTTP_PARSE_DONE);
+    assert(p.req.close && p.req.if_none_match_len == 12 && memcmp(p.req.if_none_match, "W/\"1234abcd\"", 12) == 0);
+
+    assert(parse_str(&p, "GET / HTTP/1.0\r\n\r\n") == HTTP_PARSE_DONE && p.req.close);
+    assert(parse_str(&p, "GET / HTTP/1.0\r\nConnection: keep-alive\r\n\r\n") == HTTP_PARSE_DONE && !p.req.close);
+    assert(parse_str(&p, "GET / HTTP/1.1\r\nX-Connection: close\r\nContent-Length-X: 5\r\n\r\n") == HTTP_PARSE_DONE);
+    assert(!p.req.close && p.req.content_length == 0);
+
+    // corpo: parâmetros junto com os da query, fim de linha ignorado
+    const char *post = "POST /api/floors/1?x=1 HTTP/1.1\r\nContent-Length: 22\r\n\r\naction=set&value=%317\r\n";
+    assert(parse(&p, post, strlen(post)) == strlen(post) - 1);
+    assert(http_parser_status(&p) == HTTP_PARSE_DONE && p.req.method == HTTP_METHOD_POST);
+    assert(p.req.param_count == 3 && strcmp(http_param(&p.req, "value"), "17") == 0);
+
+    assert(parse_str(&p, "POST / HTTP/1.1\r\nContent-Length: 1\r\nContent-Length: 1\r\n\r\nx") == HTTP_PARSE_BAD_REQUEST);
+    assert(parse_str(&p, "POST / HTTP/1.1\r\nContent-Length: 1x\r\n\r\nx") == HTTP_PARSE_BAD_REQUEST);
+    // espaços só em volta do número
+    assert(parse_str(&p, "POST / HTTP/1.1\r\nContent-Length: 12 34\r\n\r\n") == HTTP_PARSE_BAD_REQUEST);
+    assert(parse_str(&p, "POST / HTTP/1.1\r\nContent-Length: 1\t2\r\n\r\n") == HTTP_PARSE_BAD_REQUEST);
+    assert(parse_str(&p, "POST / HTTP/1.1\r\nContent-Length: \t 2 \t\r\n\r\nab") == HTTP_PARSE_DONE);
+    assert(p.req.content_length == 2);
+    assert(parse_str(&p, "POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n") == HTTP_PARSE_BAD_REQUEST);
+    assert(parse_str(&p, "GET / HTTP/1.1\r\n: x\r\n\r\n") == HTTP_PARSE_BAD_REQUEST);
+    assert(parse_str(&p, "GET / HTTP/1.1\r\nHost\r\n\r\n") == HTTP_PARSE_BAD_REQUEST);
+}
+
+static void test_accept_encoding(void) {
+    http_parser_t p;
+    assert(parse_str(&p, "GET / HTTP/1.1\r\n\r\n") == HTTP_PARSE_DONE && !p.req.accept_gzip);
+    assert(parse_str(&p, "GET / HTTP/1.1\r\nAccept-Encoding: gzip, deflate, br, zstd\r\n\r\n") == HTTP_PARSE_DONE);
+    assert(p.req.accept_gzip);
+    assert(parse_str(&p, "GET / HTTP/1.1\r\naccept-encoding:br,GZip;q=0.5\r\n\r\n") == HTTP_PARSE_DONE && p.req.accept_gzip);
+    assert(parse_str(&p, "GET / HTTP/1.1\r\nAccept-Encoding: x-gzip\r\n\r\n") == HTTP_PARSE_DONE && p.req.accept_gzip);
+    assert(parse_str(&p, "GET / HTTP/1.1\r\nAccept-Encoding: deflate, br\r\n\r\n") == HTTP_PARSE_DONE);
+    assert(!p.req.accept_gzip);
+    assert(parse_str(&p, "GET / HTTP/1.1\r\nAccept-Encoding: identity\r\nAccept-Encoding: gzip\r\n\r\n") == HTTP_PARSE_DONE);
+    assert(p.req.accept_gzip);
+
+    // q=0 recusa; "*" vale para gzip só se gzip não aparecer
+    assert(parse_str(&p, "GET / HTTP/1.1\r\nAccept-Encoding: gzip;q=0, br\r\n\r\n") == HTTP_PARSE_DONE);
+    assert(!p.req.accept_gzip);
+    assert(parse_str(&p, "GET / HTTP/1.1\r\nAccept-Encoding: gzip; q=0.000\r\n\r\n") == HTTP_PARSE_DONE);
+    assert(!p.req.accept_gzip);
+    assert(parse_str(&p, "GET / HTTP/1.1\r\nAccept-Encoding: gzip;q=0.01\r\n\r\n") == HTTP_PARSE_DONE && p.req.accept_gzip);
+    assert(parse_str(&p, "GET / HTTP/1.1\r\nAccept-Encoding: *\r\n\r\n") == HTTP_PARSE_DONE && p.req.accept_gzip);
+    assert(parse_str(&p, "GET / HTTP/1.1\r\nAccept-Encoding: *, gzip;q=0\r\n\r\n") == HTTP_PARSE_DONE);
+    assert(!p.req.accept_gzip);
+    assert(parse_str(&p, "GET / HTTP/1.1\r\nAccept-Encoding: *;q=0\r\n\r\n") == HTTP_PARSE_DONE && !p.req.accept_gzip);
+
+    // nome de codificação longo demais para o token não vira gzip
+    assert(parse_str(&p, "GET / HTTP/1.1\r\nAccept-Encoding: gzipgzipgzipgzipgzip\r\n\r\n") == HTTP_PARSE_DONE);
+    assert(!p.req.accept_gzip);
+}
+
+static void test_pipelining(void) {
+    http_parser_t p;
+    const char *two = "POST /api/floors HTTP/1.1\r\nContent-Length: 16\r\n\r\naction=clear_allGET /events HTTP/1.1\r\n\r\n";
+    size_t first = parse(&p, two, strlen(two));
+    assert(http_parser_status(&p) == HTTP_PARSE_DONE && strcmp(http_param(&p.req, "action"), "clear_all") == 0);
+    assert(strncmp(two + first, "GET /events", 11) == 0);
+
+    // depois de DONE não lê mais nada até o próximo init
+    assert(http_parser_feed(&p, two + first, strlen(two + first)) == 0);
+    http_parser_init(&p);
+    assert(http_parser_feed(&p, two + first, strlen(two + first)) == strlen(two + first));
+    assert(http_parser_status(&p) == HTTP_PARSE_DONE && strcmp(p.req.path, "/events") == 0);
+}
+
+static void test_limits(void) {
+    static char text[4096];
+    http_parser_t p;
+
+    memset(text, 0, sizeof text);
+    strcpy(text, "GET /");
+    memset(text + 5, 'a', HTTP_PARSER_PATH_MAX - 1);
+    strcat(text, " HTTP/1.1\r\n\r\n");
+    assert(parse_str(&p, text) == HTTP_PARSE_DONE && strlen(p.req.path) == HTTP_PARSER_PATH_MAX);
+    text[5 + HTTP_PARSER_PATH_MAX - 1] = 'a';
+    assert(parse_str(&p, text) == HTTP_PARSE_TOO_LARGE && p.limit == HTTP_LIMIT_URI);
+
+    strcpy(text, "GET /?");
+    for (int i = 0; i < 20; i++)
+        strcat(text, "key=value&");
+    strcat(text, " HTTP/1.1\r\n\r\n");
+    assert(parse_str(&p, text) == HTTP_PARSE_TOO_LARGE && p.limit == HTTP_LIMIT_URI);
+    // query só de '&' não ocupa parâmetros, mas passa do limite da linha
+    strcpy(text, "GET /?");
+    memset(text + 6, '&', HTTP_PARSER_HEAD_MAX);
+    strcpy(text + 6 + HTTP_PARSER_HEAD_MAX, " HTTP/1.1\r\n\r\n");
+    assert(parse_str(&p, text) == HTTP_PARSE_TOO_LARGE && p.limit == HTTP_LIMIT_URI);
+
+    assert(parse_str(&p, "POST / HTTP/1.1\r\nContent-Length: 257\r\n\r\n") == HTTP_PARSE_TOO_LARGE);
+    assert(p.limit == HTTP_LIMIT_BODY);
+    assert(parse_str(&p, "POST / HTTP/1.1\r\nContent-Length: 99999999999999999999\r\n\r\n") == HTTP_PARSE_TOO_LARGE);
+    assert(p.limit == HTTP_LIMIT_BODY);
+    // corpo dentro de HTTP_PARSER_BODY_MAX, mas os parâmetros não cabem
+    strcpy(text, "POST / HTTP/1.1\r\nContent-Length: 200\r\n\r\n");
+    for (int i = 0; i < 20; i++)
+        strcat(text, "key=value&");
+    assert(parse_str(&p, text) == HTTP_PARSE_TOO_LARGE && p.limit == HTTP_LIMIT_BODY);
+
+    // cabeçalhos desconhecidos não ocupam memória, mas o total é limitado
+    strcpy(text, "GET / HTTP/1.1\r\nCookie: ");
+    size_t n = strlen(text);
+    memset(text + n, 'c', HTTP_PARSER_HEAD_MAX);
+    strcpy(text + n + HTTP_PARSER_HEAD_MAX, "\r\n\r\n");
+    assert(parse_str(&p, text) == HTTP_PARSE_TOO_LARGE && p.limit == HTTP_LIMIT_HEAD);
+    // If-None-Match longo é guardado só até HTTP_PARSER_ETAG_MAX
+    strcpy(text, "GET / HTTP/1.1\r\nIf-None-Match: ");
+    n = strlen(text);
+    memset(text + n, 'e', 300);
+    strcpy(text + n + 300, "\r\n\r\n");
+    assert(parse_str(&p, text) == HTTP_PARSE_DONE && p.req.if_none_match_len == HTTP_PARSER_ETAG_MAX);
+}
+
+/* ─── FUZZING ──────────────────────────────────────────────────────── */
+static const char *corpus[] = {
+    "GET / HTTP/1.1\r\nHost: 192.168.0.10\r\nUser-Agent: Mozilla/5.0\r\nAccept: text/html\r\n\r\n",
+    "GET /?floor=3&action=set&value=42 HTTP/1.1\r\nIf-None-Match: \"1234abcd\"\r\n\r\n",
+    "POST /api/floors/2 HTTP/1.1\r\nContent-Type: application/x-www-form-urlencoded\r\nContent-Length: 19\r\n\r\naction=set&value=17",
+    "POST /api/floors/1 HTTP/1.1\r\nContent-Length:  10 \r\n\r\naction=add",
+    "POST /api/floors HTTP/1.0\r\nConnection: keep-alive\r\nContent-Length: 16\r\n\r\naction=clear_all",
+    "GET /api/%66loors/%34?a=%41+b HTTP/1.1\r\nConnection: close\r\n\r\n",
+    "GET /events HTTP/1.1\r\nAccept: text/event-stream\r\n\r\n",
+    "GET /app.js HTTP/1.1\r\nAccept-Encoding: br;q=1.0, gzip;q=0.8, *;q=0.1\r\n\r\n",
+};
+
+static uint32_t rng_state;
+
+static uint32_t rng(void) {
+    // xorshift32: reprodutível com a mesma semente
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+// Lê em pedaços aleatórios até terminar (ou acabar o texto); retorna os bytes usados
+static size_t parse_split(http_parser_t *p, const char *text, size_t len) {
+    http_parser_init(p);
+    size_t used = 0;
+    while (used < len && http_parser_status(p) == HTTP_PARSE_INCOMPLETE) {
+        size_t chunk = 1 + rng() % (len - used < 64 ? len - used : 64);
+        size_t n = http_parser_feed(p, text + used, chunk);
+        assert(n <= chunk);
+        used += n;
+        if (n < chunk)
+            break;
+    }
+    return used;
+}
+
+// O que o servidor usa de req precisa estar sempre dentro dos buffers
+static void check_request(const http_request_t *req) {
+    assert(memchr(req->path, '\0', sizeof(req->path)));
+    assert(req->if_none_match_len <= HTTP_PARSER_ETAG_MAX);
+    const char *s = req->params, *end = req->params + sizeof(req->params);
+    for (int i = 0; i < 2 * req->param_count; i++) {
+        const char *nul = memchr(s, '\0', (size_t)(end - s));
+        assert(nul);
+        s = nul + 1;
+    }
+    http_param(req, "floor");
+    http_param(req, "action");
+}
+
+static void fuzz_one(const char *text, size_t len) {
+    http_parser_t whole, split;
+    size_t used = parse(&whole, text, len);
+    assert(used <= len);
+    // mesmo resultado, não importa onde os pbufs cortam
+    size_t used_split = parse_split(&split, text, len);
+    assert(used_split == used);
+    assert(http_parser_status(&split) == http_parser_status(&whole));
+    if (http_parser_status(&whole) == HTTP_PARSE_TOO_LARGE)
+        assert(split.limit == whole.limit);
+    assert(memcmp(&split.req, &whole.req, sizeof(whole.req)) == 0);
+    if (http_parser_status(&whole) == HTTP_PARSE_DONE)
+        check_request(&whole.req);
+}
+
+static void fuzz(unsigned iterations) {
+    static const char alphabet[] = "GETPOST /?&=%+:\r\n0123456789abcdefXYZ\"";
+    static char text[1024];
+    size_t ncorpus = sizeof(corpus) / sizeof(corpus[0]);
+    unsigned done = 0;
+
+    for (unsigned i = 0; i < iterations; i++) {
+        size_t len;
+        switch (rng() % 3) {
+        case 0: {   // válida, sozinha ou seguida de outra (pipelining)
+            const char *a = corpus[rng() % ncorpus], *b = corpus[rng() % ncorpus];
+            len = (size_t)snprintf(text, sizeof text, "%s%s", a, (rng() & 1) ? b : "");
+            break;
+        }
+        case 1: {   // válida com bytes trocados, inseridos ou cortada
+            const char *a = corpus[rng() % ncorpus];
+            len = strlen(a);
+            memcpy(text, a, len);
+            for (unsigned k = 1 + rng() % 4; k; k--) {
+                size_t at = rng() % len;
+                switch (rng() % 3) {
+                case 0: text[at] = (char)rng(); break;
+                case 1: text[at] = alphabet[rng() % (sizeof(alphabet) - 1)]; break;
+                case 2:
+                    if (len < sizeof(text) - 1) {
+                        memmove(text + at + 1, text + at, len - at);
+                        text[at] = alphabet[rng() % (sizeof(alphabet) - 1)];
+                        len++;
+                    }
+                    break;
+                }
+            }
+            len -= rng() % 4 == 0 ? rng() % len : 0;
+            break;
+        }
+        default:    // lixo
+            len = rng() % sizeof(text);
+            for (size_t k = 0; k < len; k++)
+                text[k] = (rng() & 1) ? (char)rng() : alphabet[rng() % (sizeof(alphabet) - 1)];
+            break;
+        }
+        fuzz_one(text, len);
+
+        http_parser_t p;
+        parse(&p, text, len);
+        done += http_parser_status(&p) == HTTP_PARSE_DONE;
+    }
+    printf("fuzz: %u entradas, %u requisicoes completas\n", iterations, done);
+}
+
+int main(int argc, char **argv) {
+    unsigned iterations = argc > 1 ? (unsigned)strtoul(argv[1], NULL, 10) : 200000;
+    rng_state = argc > 2 ? (uint32_t)strtoul(argv[2], NULL, 10) : 0x2545f491;
+
+    test_request_line();
+    test_percent();
+    test_headers();
+    test_accept_encoding();
+    test_pipelining();
+    test_limits();
+    fuzz(iterations);
+    printf("test_http_parser OK\n");
+    return 0;
+}
@@ -0,0 +1,215 @@
+/*
+ * Gerador dos arquivos estáticos da interface web (generated/web_assets.h).
+ *
+ * Comprime no PC, uma vez, o que o servidor mandaria sem compressão a cada
+ * carga da página: cada arquivo de web/ vira dois arrays constantes (gzip e
+ * original) com as respostas prontas, cabeçalhos inclusive (Content-Length,
+ * ETag, Content-Encoding, 304), e uma entrada na tabela web_assets[] que
+ * http_assets.c consulta. O Pico não comprime nada.
+ *
+ * Caminho servido: index.html vira "/", o resto "/<nome do arquivo>". A ETag
+ * é o FNV-1a do corpo de cada variante, então muda só quando o arquivo muda.
+ * O gzip é conferido descomprimindo de novo antes de escrever.
+ *
+ * O build do firmware (CMakeLists.txt) compila este programa para o PC e
+ * gera o cabeçalho sozinho sempre que algo em web/ muda. À mão (a partir de
+ * projetos/bitdoglab_checkin_c):
+ *   gcc -std=c11 -O2 -Wall -I. tools/gen_assets.c -lz -o gen_assets && \
+ *   ./gen_assets -o generated/web_assets.h web/index.html web/app.css web/app.js
+ *
+ * Com -o o arquivo só é aberto depois de todos os arquivos lidos e
+ * comprimidos: um erro não deixa o cabeçalho antigo truncado.
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+
+#define MAX_ASSETS 16
+#define MAX_SIZE   16384   // arquivo original; cabe num uint16_t mesmo sem compressão
+#define MAX_NAME   32
+
+typedef struct {
+    const char *file;
+    char path[MAX_NAME + 2];
+    char ident[MAX_NAME + 1];      // nome em C: "app.css" -> "app_css"
+    const char *type;
+    unsigned char data[MAX_SIZE];
+    size_t len;
+    unsigned char gz[MAX_SIZE + 64];
+    size_t gz_len;
+} asset_t;
+
+static asset_t assets[MAX_ASSETS];
+
+static const struct {
+    const char *ext;
+    const char *type;
+} types[] = {
+    { ".html", "text/html; charset=utf-8" },
+    { ".css",  "text/css; charset=utf-8" },
+    { ".js",   "text/javascript; charset=utf-8" },
+    { ".json", "application/json" },
+    { ".svg",  "image/svg+xml" },
+    { ".ico",  "image/x-icon" },
+};
+
+static void fail(const char *what, const char *file) {
+    fprintf(stderr, "gen_assets: %s: %s\n", file, what);
+    exit(1);
+}
+
+static uint32_t fnv(const unsigned char *s, size_t len) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++)
+        h = (h ^ s[i]) * 16777619u;
+    return h;
+}
+
+static void load(asset_t *a, const char *file) {
+    const char *base = strrchr(file, '/');
+    base = base ? base + 1 : file;
+    if (strlen(base) > MAX_NAME)
+        fail("nome longo demais", file);
+    a->file = file;
+    snprintf(a->path, sizeof(a->path), "/%s", strcmp(base, "index.html") == 0 ? "" : base);
+    for (size_t i = 0; base[i]; i++)
+        a->ident[i] = (base[i] >= 'a' && base[i] <= 'z') || (base[i] >= '0' && base[i] <= '9') ? base[i] : '_';
+
+    const char *ext = strrchr(base, '.');
+    for (size_t i = 0; ext && i < sizeof(types) / sizeof(types[0]); i++)
+        if (strcmp(ext, types[i].ext) == 0)
+            a->type = types[i].type;
+    if (!a->type)
+        fail("extensão sem Content-Type conhecido", file);
+
+    FILE *f = fopen(file, "rb");
+    if (!f)
+        fail("não abriu", file);
+    a->len = fread(a->data, 1, sizeof(a->data), f);
+    if (!feof(f) || fgetc(f) != EOF)
+        fail("maior que MAX_SIZE", file);
+    fclose(f);
+}
+
+// gzip (cabeçalho sem data nem nome: a saída só muda se o arquivo mudar)
+static void compress_gzip(asset_t *a) {
+    z_stream z = {0};
+    if (deflateInit2(&z, Z_BEST_COMPRESSION, Z_DEFLATED, 15 + 16, 9, Z_DEFAULT_STRATEGY) != Z_OK)
+        fail("deflateInit2", a->file);
+    z.next_in = a->data;
+    z.avail_in = (uInt)a->len;
+    z.next_out = a->gz;
+    z.avail_out = sizeof(a->gz);
+    if (deflate(&z, Z_FINISH) != Z_STREAM_END)
+        fail("deflate", a->file);
+    a->gz_len = z.total_out;
+    deflateEnd(&z);
+
+    static unsigned char check[MAX_SIZE];
+    z_stream u = {0};
+    if (inflateInit2(&u, 15 + 16) != Z_OK)
+        fail("inflateInit2", a->file);
+    u.next_in = a->gz;
+    u.avail_in = (uInt)a->gz_len;
+    u.next_out = check;
+    u.avail_out = sizeof(check);
+    if (inflate(&u, Z_FINISH) != Z_STREAM_END || u.total_out != a->len || memcmp(check, a->data, a->len) != 0)
+        fail("gzip não confere", a->file);
+    inflateEnd(&u);
+}
+
+/* ─── SAÍDA ────────────────────────────────────────────────────────── */
+// Literal só de escapes \xNN, 16 bytes por linha (char pode ter sinal: nada de {0x8b, ...})
+static void print_bytes(const unsigned char *data, size_t len) {
+    for (size_t i = 0; i < len; i++)
+        printf("%s\\x%02x%s", i % 16 ? "" : "\n    \"", data[i], i % 16 == 15 || i + 1 == len ? "\"" : "");
+}
+
+// Cabeçalhos de uma variante; retorna o tamanho do 200 (cabeçalho + corpo)
+static size_t print_variant(const asset_t *a, const char *name, const unsigned char *body, size_t len,
+                            bool gzip) {
+    char head[512];
+    uint32_t etag = fnv(body, len);
+    int n = snprintf(head, sizeof(head),
+                     "HTTP/1.1 200 OK\\r\\nContent-Type: %s\\r\\n%sVary: Accept-Encoding\\r\\n"
+                     "Cache-Control: no-cache\\r\\nETag: \\\"%08x\\\"\\r\\nContent-Length: %zu\\r\\n\\r\\n",
+                     a->type, gzip ? "Content-Encoding: gzip\\r\\n" : "", etag, len);
+    printf("static const char web_%s_%s_head[] =\n    \"%s\";\n", a->ident, name, head);
+    printf("static const char web_%s_%s_304[] =\n    \"HTTP/1.1 304 Not Modified\\r\\nVary: Accept-Encoding\\r\\n"
+           "Cache-Control: no-cache\\r\\nETag: \\\"%08x\\\"\\r\\n\\r\\n\";\n", a->ident, name, etag);
+    printf("static const char web_%s_%s_etag[] = \"\\\"%08x\\\"\";\n", a->ident, name, etag);
+    printf("static const char web_%s_%s_body[] =", a->ident, name);
+    print_bytes(body, len);
+    printf(";\n\n");
+
+    // cada \\r, \\n e \\\" escrito acima ocupa 1 byte na resposta
+    size_t head_len = 0;
+    for (int i = 0; i < n; i++, head_len++)
+        if (head[i] == '\\')
+            i++;
+    return head_len + len;
+}
+
+static void print_entry(const asset_t *a, const char *name) {
+    printf("        { web_%s_%s_head, web_%s_%s_body, web_%s_%s_304, web_%s_%s_etag,\n"
+           "          sizeof(web_%s_%s_head) - 1, sizeof(web_%s_%s_body) - 1, sizeof(web_%s_%s_304) - 1 },\n",
+           a->ident, name, a->ident, name, a->ident, name, a->ident, name,
+           a->ident, name, a->ident, name, a->ident, name);
+}
+
+int main(int argc, char **argv) {
+    const char *output = NULL;
+    int first = 1;
+    if (argc > 2 && strcmp(argv[1], "-o") == 0) {
+        output = argv[2];
+        first = 3;
+    }
+    int count = argc - first;
+    if (count < 1 || count > MAX_ASSETS) {
+        fprintf(stderr, "uso: %s [-o generated/web_assets.h] web/index.html web/app.css ...\n", argv[0]);
+        return 1;
+    }
+    for (int i = 0; i < count; i++) {
+        load(&assets[i], argv[first + i]);
+        compress_gzip(&assets[i]);
+    }
+    if (output && !freopen(output, "w", stdout))
+        fail("não abriu para escrita", output);
+
+    printf("/*\n * Gerado por tools/gen_assets.c a partir de web/; não editar.\n *\n");
+    size_t total = 0, total_gz = 0;
+    for (int i = 0; i < count; i++) {
+        printf(" *   %-12s %-10s %5zu bytes, gzip %5zu\n", assets[i].path, strrchr(assets[i].file, '/') ?
+               strrchr(assets[i].file, '/') + 1 : assets[i].file, assets[i].len, assets[i].gz_len);
+        total += assets[i].len;
+        total_gz += assets[i].gz_len;
+    }
+    printf(" *   total                   %5zu bytes, gzip %5zu\n */\n", total, total_gz);
+    printf("#ifndef WEB_ASSETS_H\n#define WEB_ASSETS_H\n\n#include \"http_assets.h\"\n\n");
+
+    size_t max = 0;
+    for (int i = 0; i < count; i++) {
+        size_t gz = print_variant(&assets[i], "gzip", assets[i].gz, assets[i].gz_len, true);
+        size_t id = print_variant(&assets[i], "identity", assets[i].data, assets[i].len, false);
+        if (gz > max)
+            max = gz;
+        if (id > max)
+            max = id;
+    }
+
+    printf("// Maior resposta 200 (cabeçalho + corpo) entre todas as variantes\n");
+    printf("#define WEB_ASSETS_RESPONSE_MAX %zu\n\n", max);
+    printf("#define WEB_ASSETS_COUNT %d\n\n", count);
+    printf("static const http_asset_t web_assets[WEB_ASSETS_COUNT] = {\n");
+    for (int i = 0; i < count; i++) {
+        printf("    { \"%s\",\n", assets[i].path);
+        print_entry(&assets[i], "gzip");
+        print_entry(&assets[i], "identity");
+        printf("    },\n");
+    }
+    printf("};\n\n#endif\n");
+    return 0;
+}
@@ -0,0 +1,95 @@
+// Monitor de ocupação: o estado vem de /api/floors e /events (JSON),
+// as alterações vão por POST para /api/floors/{n}.
+'use strict';
+
+var rows = [];
+var max = 50;
+var statusText = document.getElementById('status');
+
+function floorName(i) {
+  return i ? 'Andar ' + i : 'Térreo';
+}
+
+function show(floor, count) {
+  var row = rows[floor];
+  if (!row) return;
+  row.count.textContent = count;
+  row.tr.className = count >= max ? 'full' : '';
+}
+
+function button(label, action, floor) {
+  var b = document.createElement('button');
+  b.textContent = label;
+  b.onclick = function () { post(floor, action); };
+  return b;
+}
+
+// Uma linha por andar, criada na primeira resposta; depois só o número muda
+function build(n) {
+  var body = document.getElementById('floors');
+  for (var i = rows.length; i < n; i++) {
+    var tr = body.insertRow();
+    tr.insertCell().textContent = floorName(i);
+    var count = tr.insertCell();
+    count.className = 'count';
+    var cell = tr.insertCell();
+    var value = document.createElement('input');
+    value.type = 'number';
+    value.min = 0;
+    value.placeholder = 'N';
+    cell.append(button('+', 'add', i), ' ', button('−', 'remove', i), ' ',
+                button('0', 'clear', i), ' ', value, button('definir', 'set', i));
+    rows.push({ tr: tr, count: count, value: value });
+  }
+}
+
+function showAll(state) {
+  max = state.max || max;
+  build(state.floors.length);
+  state.floors.forEach(function (count, i) { show(i, count); });
+}
+
+function request(url, body) {
+  var init = body ? { method: 'POST', body: new URLSearchParams(body) } : {};
+  return fetch(url, init).then(function (r) {
+    return r.json().then(function (json) {
+      if (!r.ok) throw new Error(json.error || r.status);
+      statusText.textContent = '';
+      return json;
+    });
+  }).catch(function (e) {
+    statusText.textContent = 'Erro: ' + e.message;
+    throw e;
+  });
+}
+
+function post(floor, action) {
+  var body = { action: action };
+  if (action === 'set') body.value = rows[floor].value.value;
+  request('/api/floors/' + floor, body).then(function (f) { show(f.floor, f.count); }, function () {});
+}
+
+function refresh() {
+  request('/api/floors').then(showAll, function () {});
+}
+
+document.getElementById('clear-all').onclick = function () {
+  request('/api/floors', { action: 'clear_all' }).then(showAll, function () {});
+};
+
+// Eventos: estado completo ao conectar, depois um andar por mensagem. Sem
+// vaga em /events (503), o navegador desiste e a página consulta a cada 2 s.
+refresh();
+if (window.EventSource) {
+  var events = new EventSource('/events');
+  events.addEventListener('floors', function (e) { showAll(JSON.parse(e.data)); });
+  events.onmessage = function (e) {
+    var f = JSON.parse(e.data);
+    show(f.floor, f.count);
+  };
+  events.onerror = function () {
+    if (events.readyState === EventSource.CLOSED) setInterval(refresh, 2000);
+  };
+} else {
+  setInterval(refresh, 2000);
+}
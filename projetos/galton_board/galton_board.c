@@ -14,9 +14,9 @@
  #include "hardware/gpio.h"
  #include "hardware/irq.h"
  
- #include "src/ssd1306.h"
- #include "src/ssd1306_i2c.h"
- #include "src/ssd1306_font.h"
+ #include "ssd1306.h"
+ #include "ssd1306_i2c.h"
+ #include "ssd1306_font.h"
  
  /* ---- Botões ---- */
  #define BUTTON_A   5
@@ -76,9 +76,7 @@
  static void draw_bar(int bin, int height, int y0) {
      if (height <= 0) return;
      int x0 = bin * BIN_W;
-     for (int dx = 0; dx < BIN_W - 1; dx++)
-         for (int dy = 0; dy < height; dy++)
-             ssd1306_draw_pixel(&disp, x0 + dx, y0 - dy);
+     ssd1306_draw_square(&disp, x0, y0 - height + 1, BIN_W - 1, height);
  }
  
  /* Desenha triângulo de pinos limitando à largura real */
@@ -108,6 +106,12 @@
          printf("OLED init falhou\n");
          while (1) tight_loop_contents();
      }
+     /* quadros seguem por DMA enquanto a física do próximo tick roda */
+     if (!ssd1306_async_init(&disp))
+         printf("OLED sem DMA, usando envio bloqueante\n");
+     /* só os bytes que mudaram desde o último quadro vão para o barramento */
+     if (!ssd1306_shadow_init(&disp))
+         printf("OLED sem copia do quadro, enviando janela inteira\n");
      ssd1306_clear(&disp);
      ssd1306_show(&disp);
  }
@@ -216,7 +220,7 @@
              ssd1306_draw_string(&disp, 0, 0, 1, buf);
          }
  
-         ssd1306_show(&disp);
+         ssd1306_show_async(&disp);
  
          sleep_ms(TICK_MS);
          tick++;